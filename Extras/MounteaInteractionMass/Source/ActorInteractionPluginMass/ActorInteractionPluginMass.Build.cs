@@ -0,0 +1,34 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+using UnrealBuildTool;
+
+public class ActorInteractionPluginMass : ModuleRules
+{
+	public ActorInteractionPluginMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange
+			(
+				new string[]
+				{
+					"Core",
+					"CoreUObject",
+					"Engine",
+					"GameplayTags",
+					"MassEntity",
+					"MassCommon",
+					"MassSpawner",
+					"ActorInteractionPlugin"
+				}
+			);
+		
+		PrivateDependencyModuleNames.AddRange
+			(
+				new string[]
+				{
+					"StructUtils"
+				}
+			);
+	}
+}
@@ -0,0 +1,17 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "ActorInteractionPluginMass.h"
+
+#define LOCTEXT_NAMESPACE "FActorInteractionPluginMass"
+
+void FActorInteractionPluginMass::StartupModule()
+{
+}
+
+void FActorInteractionPluginMass::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FActorInteractionPluginMass, ActorInteractionPluginMass)
@@ -0,0 +1,245 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Mass/MounteaInteractableMassProcessors.h"
+
+#include "Engine/World.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+
+#include "Mass/MounteaInteractableMassFragments.h"
+#include "Mass/MounteaInteractableMassProxy.h"
+#include "Mass/MounteaInteractableMassSubsystem.h"
+
+#pragma region Cooldown
+
+UMounteaInteractableCooldownProcessor::UMounteaInteractableCooldownProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+}
+
+void UMounteaInteractableCooldownProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FMounteaInteractableFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FMounteaInteractableConfigFragment>();
+	EntityQuery.AddTagRequirement<FMounteaInteractablePromotedTag>(EMassFragmentPresence::None);
+}
+
+void UMounteaInteractableCooldownProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+	{
+		const TArrayView<FMounteaInteractableFragment> interactables = Context.GetMutableFragmentView<FMounteaInteractableFragment>();
+		const FMounteaInteractableConfigFragment& config = Context.GetConstSharedFragment<FMounteaInteractableConfigFragment>();
+		const float deltaTime = Context.GetDeltaTimeSeconds();
+
+		for (FMounteaInteractableFragment& interactable : interactables)
+		{
+			if (interactable.State != EInteractableStateV2::EIS_Cooldown)
+			{
+				continue;
+			}
+
+			interactable.CooldownRemaining -= deltaTime;
+			if (interactable.CooldownRemaining <= 0.f)
+			{
+				interactable.CooldownRemaining = 0.f;
+				interactable.State = config.DefaultState;
+			}
+		}
+	});
+}
+
+#pragma endregion
+
+#pragma region Lifecycle
+
+UMounteaInteractableLifecycleProcessor::UMounteaInteractableLifecycleProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteAfter.Add(UMounteaInteractableCooldownProcessor::StaticClass()->GetFName());
+}
+
+void UMounteaInteractableLifecycleProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FMounteaInteractableFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FMounteaInteractableConfigFragment>();
+	EntityQuery.AddTagRequirement<FMounteaInteractablePromotedTag>(EMassFragmentPresence::None);
+}
+
+void UMounteaInteractableLifecycleProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
+	{
+		const TArrayView<FMounteaInteractableFragment> interactables = Context.GetMutableFragmentView<FMounteaInteractableFragment>();
+		const FMounteaInteractableConfigFragment& config = Context.GetConstSharedFragment<FMounteaInteractableConfigFragment>();
+
+		for (int32 entityIndex = 0; entityIndex < Context.GetNumEntities(); ++entityIndex)
+		{
+			FMounteaInteractableFragment& interactable = interactables[entityIndex];
+
+			if (interactable.RemainingLifecycleCount == 0)
+			{
+				interactable.State = EInteractableStateV2::EIS_Completed;
+			}
+
+			if (interactable.State == EInteractableStateV2::EIS_Completed && config.bDestroyWhenCompleted)
+			{
+				Context.Defer().DestroyEntity(Context.GetEntity(entityIndex));
+			}
+		}
+	});
+}
+
+#pragma endregion
+
+#pragma region Demotion
+
+UMounteaInteractableDemotionProcessor::UMounteaInteractableDemotionProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteBefore.Add(UMounteaInteractableCooldownProcessor::StaticClass()->GetFName());
+
+	// Proxies are Actors, they must be touched on Game Thread only
+	bRequiresGameThreadExecution = true;
+}
+
+void UMounteaInteractableDemotionProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FMounteaInteractableFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FMounteaInteractableConfigFragment>();
+	EntityQuery.AddTagRequirement<FMounteaInteractablePromotedTag>(EMassFragmentPresence::All);
+}
+
+void UMounteaInteractableDemotionProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMounteaInteractableMassSubsystem* massSubsystem = UWorld::GetSubsystem<UMounteaInteractableMassSubsystem>(EntityManager.GetWorld());
+	if (massSubsystem == nullptr)
+	{
+		return;
+	}
+
+	const float worldTime = EntityManager.GetWorld()->GetTimeSeconds();
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [massSubsystem, worldTime](FMassExecutionContext& Context)
+	{
+		const TArrayView<FMounteaInteractableFragment> interactables = Context.GetMutableFragmentView<FMounteaInteractableFragment>();
+		const FMounteaInteractableConfigFragment& config = Context.GetConstSharedFragment<FMounteaInteractableConfigFragment>();
+		const float deltaTime = Context.GetDeltaTimeSeconds();
+
+		for (int32 entityIndex = 0; entityIndex < Context.GetNumEntities(); ++entityIndex)
+		{
+			const FMassEntityHandle entity = Context.GetEntity(entityIndex);
+			FMounteaInteractableFragment& interactable = interactables[entityIndex];
+
+			const AMounteaInteractableMassProxy* proxy = massSubsystem->FindProxy(entity);
+			if (proxy && proxy->IsEngaged())
+			{
+				interactable.IdleTime = 0.f;
+				continue;
+			}
+
+			interactable.IdleTime += deltaTime;
+
+			// Both idle and not queried within Demotion Distance for Demotion Delay
+			const float unqueriedTime = proxy ? worldTime - proxy->GetKeepPromotedTime() : interactable.IdleTime;
+			if (proxy && FMath::Min(interactable.IdleTime, unqueriedTime) < config.DemotionDelay)
+			{
+				continue;
+			}
+
+			// Proxy destroyed by anyone else is demoted with last known state
+			if (proxy)
+			{
+				proxy->WriteFragment(interactable);
+			}
+			interactable.IdleTime = 0.f;
+
+			massSubsystem->ReleaseProxy(entity);
+			Context.Defer().RemoveTag<FMounteaInteractablePromotedTag>(entity);
+		}
+	});
+}
+
+#pragma endregion
+
+#pragma region Grid
+
+UMounteaInteractableGridAddObserver::UMounteaInteractableGridAddObserver()
+	: EntityQuery(*this)
+{
+	ObservedType = FMounteaInteractableFragment::StaticStruct();
+	Operation = EMassObservedOperation::Add;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+
+	// Grid lives in World Subsystem
+	bRequiresGameThreadExecution = true;
+}
+
+void UMounteaInteractableGridAddObserver::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMounteaInteractableFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddConstSharedRequirement<FMounteaInteractableConfigFragment>();
+}
+
+void UMounteaInteractableGridAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMounteaInteractableMassSubsystem* massSubsystem = UWorld::GetSubsystem<UMounteaInteractableMassSubsystem>(EntityManager.GetWorld());
+	if (massSubsystem == nullptr)
+	{
+		return;
+	}
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [massSubsystem](FMassExecutionContext& Context)
+	{
+		const TConstArrayView<FTransformFragment> transforms = Context.GetFragmentView<FTransformFragment>();
+		const FMounteaInteractableConfigFragment& config = Context.GetConstSharedFragment<FMounteaInteractableConfigFragment>();
+
+		for (int32 entityIndex = 0; entityIndex < Context.GetNumEntities(); ++entityIndex)
+		{
+			massSubsystem->AddToGrid(Context.GetEntity(entityIndex), transforms[entityIndex].GetTransform().GetLocation(), config);
+		}
+	});
+}
+
+UMounteaInteractableGridRemoveObserver::UMounteaInteractableGridRemoveObserver()
+	: EntityQuery(*this)
+{
+	ObservedType = FMounteaInteractableFragment::StaticStruct();
+	Operation = EMassObservedOperation::Remove;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+
+	// Grid lives in World Subsystem
+	bRequiresGameThreadExecution = true;
+}
+
+void UMounteaInteractableGridRemoveObserver::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FMounteaInteractableFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+void UMounteaInteractableGridRemoveObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UMounteaInteractableMassSubsystem* massSubsystem = UWorld::GetSubsystem<UMounteaInteractableMassSubsystem>(EntityManager.GetWorld());
+	if (massSubsystem == nullptr)
+	{
+		return;
+	}
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [massSubsystem](FMassExecutionContext& Context)
+	{
+		for (int32 entityIndex = 0; entityIndex < Context.GetNumEntities(); ++entityIndex)
+		{
+			massSubsystem->RemoveFromGrid(Context.GetEntity(entityIndex));
+		}
+	});
+}
+
+#pragma endregion
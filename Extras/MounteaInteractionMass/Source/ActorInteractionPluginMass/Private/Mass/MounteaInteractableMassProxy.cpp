@@ -0,0 +1,97 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Mass/MounteaInteractableMassProxy.h"
+
+#include "Components/SphereComponent.h"
+#include "TimerManager.h"
+
+#include "Components/Interactable/ActorInteractableComponentBase.h"
+#include "Helpers/MounteaInteractableInitializationSubsystem.h"
+#include "Mass/MounteaInteractableMassFragments.h"
+
+AMounteaInteractableMassProxy::AMounteaInteractableMassProxy()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	bReplicates = true;
+	SetReplicatingMovement(false);
+
+	CollisionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionSphere"));
+	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	CollisionSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+	CollisionSphere->SetGenerateOverlapEvents(false);
+	CollisionSphere->SetCanEverAffectNavigation(false);
+
+	SetRootComponent(CollisionSphere);
+}
+
+void AMounteaInteractableMassProxy::InitializeProxy(const FMassEntityHandle& NewEntityHandle, const FMounteaInteractableConfigFragment& Config, const FMounteaInteractableFragment& Fragment)
+{
+	EntityHandle = NewEntityHandle;
+
+	KeepPromoted();
+
+	CollisionSphere->SetSphereRadius(Config.InteractionRadius);
+
+	const UClass* interactableClass = Config.InteractableClass.Get();
+	if (interactableClass == nullptr || interactableClass->HasAnyClassFlags(CLASS_Abstract))
+	{
+		return;
+	}
+
+	Interactable = NewObject<UActorInteractableComponentBase>(this, interactableClass, TEXT("Interactable"));
+	Interactable->SetInteractableArchetype(Config.InteractableArchetype);
+	IActorInteractableInterface::Execute_ToggleAutoSetup(Interactable, ESetupType::EST_None);
+	IActorInteractableInterface::Execute_SetDefaultState(Interactable, Fragment.State);
+
+	// Registering after BeginPlay starts Interactable immediately, promoted Interactable must be usable this frame
+	AddInstanceComponent(Interactable);
+	Interactable->RegisterComponent();
+	UMounteaInteractableInitializationSubsystem::InitializeImmediately(Interactable);
+
+	IActorInteractableInterface::Execute_AddCollisionComponent(Interactable, CollisionSphere);
+	IActorInteractableInterface::Execute_SetInteractableWeight(Interactable, Fragment.Weight);
+	Interactable->SetRemainingLifecycleCount(Fragment.RemainingLifecycleCount);
+}
+
+void AMounteaInteractableMassProxy::WriteFragment(FMounteaInteractableFragment& Fragment) const
+{
+	if (Interactable == nullptr)
+	{
+		return;
+	}
+
+	Fragment.State = IActorInteractableInterface::Execute_GetState(Interactable);
+	Fragment.Weight = IActorInteractableInterface::Execute_GetInteractableWeight(Interactable);
+	Fragment.RemainingLifecycleCount = IActorInteractableInterface::Execute_GetRemainingLifecycleCount(Interactable);
+	Fragment.CooldownRemaining = 0.f;
+
+	if (Fragment.State == EInteractableStateV2::EIS_Cooldown)
+	{
+		Fragment.CooldownRemaining = GetWorldTimerManager().GetTimerRemaining(Interactable->GetCooldownHandle());
+	}
+}
+
+bool AMounteaInteractableMassProxy::IsEngaged() const
+{
+	if (Interactable == nullptr)
+	{
+		return false;
+	}
+
+	switch (IActorInteractableInterface::Execute_GetState(Interactable))
+	{
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Paused:
+			return true;
+		default:
+			break;
+	}
+
+	return IActorInteractableInterface::Execute_DoesHaveInteractor(Interactable);
+}
+
+void AMounteaInteractableMassProxy::KeepPromoted()
+{
+	KeepPromotedTime = GetWorld()->GetTimeSeconds();
+}
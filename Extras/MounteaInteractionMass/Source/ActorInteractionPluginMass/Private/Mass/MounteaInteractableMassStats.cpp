@@ -0,0 +1,9 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Mass/MounteaInteractableMassStats.h"
+
+DEFINE_STAT(STAT_MounteaInteraction_MassPromotionQuery);
+
+DEFINE_STAT(STAT_MounteaInteraction_MassPromotions);
+DEFINE_STAT(STAT_MounteaInteraction_MassDemotions);
+DEFINE_STAT(STAT_MounteaInteraction_MassGridEntities);
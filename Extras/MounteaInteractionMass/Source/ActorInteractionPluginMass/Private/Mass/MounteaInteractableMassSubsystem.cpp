@@ -0,0 +1,238 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Mass/MounteaInteractableMassSubsystem.h"
+
+#include "Engine/World.h"
+#include "MassCommonFragments.h"
+#include "MassEntityManager.h"
+#include "MassEntitySubsystem.h"
+
+#include "Mass/MounteaInteractableMassFragments.h"
+#include "Mass/MounteaInteractableMassProxy.h"
+#include "Mass/MounteaInteractableMassStats.h"
+
+void UMounteaInteractableMassSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Collection.InitializeDependency<UMassEntitySubsystem>();
+}
+
+void UMounteaInteractableMassSubsystem::Deinitialize()
+{
+	for (const auto& promotedProxy : PromotedProxies)
+	{
+		if (IsValid(promotedProxy.Value))
+		{
+			promotedProxy.Value->Destroy();
+		}
+	}
+	PromotedProxies.Empty();
+
+	GridCells.Empty();
+	GridEntityCells.Empty();
+	MaxGridEntityReach = 0.f;
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_MassGridEntities, 0);
+
+	Super::Deinitialize();
+}
+
+bool UMounteaInteractableMassSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaInteractableMassSubsystem::PromoteInteractables(const FVector& Start, const FVector& End, const float Radius, const TScriptInterface<IActorInteractorInterface>& Interactor)
+{
+	const UWorld* world = GetWorld();
+	if (world == nullptr || world->GetNetMode() == NM_Client || GridCells.Num() == 0)
+	{
+		return;
+	}
+
+	UMassEntitySubsystem* entitySubsystem = world->GetSubsystem<UMassEntitySubsystem>();
+	if (entitySubsystem == nullptr)
+	{
+		return;
+	}
+
+	MOUNTEA_INTERACTION_SCOPE(MassPromotionQuery, STAT_MounteaInteraction_MassPromotionQuery);
+
+	struct FPromotionCandidate
+	{
+		FMassEntityHandle Entity;
+		FTransform Transform;
+		const FMounteaInteractableConfigFragment* Config;
+		FMounteaInteractableFragment Fragment;
+	};
+	TArray<FPromotionCandidate> promotionCandidates;
+
+	const FMassEntityManager& entityManager = entitySubsystem->GetEntityManager();
+
+	// Only cells touched by query extended by the largest reach of any Entity are visited
+	const float queryReach = Radius + MaxGridEntityReach;
+	const FIntPoint minCell = GetGridCell(Start.ComponentMin(End) - FVector(queryReach));
+	const FIntPoint maxCell = GetGridCell(Start.ComponentMax(End) + FVector(queryReach));
+
+	for (int32 cellX = minCell.X; cellX <= maxCell.X; ++cellX)
+	{
+		for (int32 cellY = minCell.Y; cellY <= maxCell.Y; ++cellY)
+		{
+			const TArray<FGridEntity>* gridCell = GridCells.Find(FIntPoint(cellX, cellY));
+			if (gridCell == nullptr)
+			{
+				continue;
+			}
+
+			for (const FGridEntity& gridEntity : *gridCell)
+			{
+				const float interactionReach = Radius + gridEntity.Config->InteractionRadius;
+				const float distanceSquared = FMath::PointDistToSegmentSquared(gridEntity.Location, Start, End);
+				if (distanceSquared > FMath::Square(interactionReach + gridEntity.Config->DemotionDistance))
+				{
+					continue;
+				}
+
+				// Promoted Entities within Demotion Distance stay promoted
+				if (AMounteaInteractableMassProxy* proxy = FindProxy(gridEntity.Entity))
+				{
+					proxy->KeepPromoted();
+					continue;
+				}
+
+				if (distanceSquared > FMath::Square(interactionReach))
+				{
+					continue;
+				}
+
+				const FMounteaInteractableFragment* interactableFragment = entityManager.GetFragmentDataPtr<FMounteaInteractableFragment>(gridEntity.Entity);
+				if (interactableFragment == nullptr || interactableFragment->State != EInteractableStateV2::EIS_Awake || PromotedProxies.Contains(gridEntity.Entity))
+				{
+					continue;
+				}
+
+				const FTransformFragment* transformFragment = entityManager.GetFragmentDataPtr<FTransformFragment>(gridEntity.Entity);
+				promotionCandidates.Add({ gridEntity.Entity, transformFragment ? transformFragment->GetTransform() : FTransform(gridEntity.Location), gridEntity.Config, *interactableFragment });
+			}
+		}
+	}
+
+	// Actors are spawned outside of grid iteration
+	for (const FPromotionCandidate& promotionCandidate : promotionCandidates)
+	{
+		PromoteEntity(promotionCandidate.Entity, promotionCandidate.Transform, *promotionCandidate.Config, promotionCandidate.Fragment);
+	}
+}
+
+void UMounteaInteractableMassSubsystem::AddToGrid(const FMassEntityHandle& Entity, const FVector& Location, const FMounteaInteractableConfigFragment& Config)
+{
+	RemoveFromGrid(Entity);
+
+	const FIntPoint gridCell = GetGridCell(Location);
+	GridCells.FindOrAdd(gridCell).Add({ Entity, Location, &Config });
+	GridEntityCells.Add(Entity, gridCell);
+
+	MaxGridEntityReach = FMath::Max(MaxGridEntityReach, Config.InteractionRadius + Config.DemotionDistance);
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_MassGridEntities, GridEntityCells.Num());
+}
+
+void UMounteaInteractableMassSubsystem::RemoveFromGrid(const FMassEntityHandle& Entity)
+{
+	FIntPoint gridCell;
+	if (!GridEntityCells.RemoveAndCopyValue(Entity, gridCell))
+	{
+		return;
+	}
+
+	if (TArray<FGridEntity>* gridEntities = GridCells.Find(gridCell))
+	{
+		gridEntities->RemoveAllSwap([&Entity](const FGridEntity& GridEntity) { return GridEntity.Entity == Entity; }, EAllowShrinking::No);
+		if (gridEntities->Num() == 0)
+		{
+			GridCells.Remove(gridCell);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_MassGridEntities, GridEntityCells.Num());
+}
+
+void UMounteaInteractableMassSubsystem::PromoteEntity(const FMassEntityHandle& Entity, const FTransform& Transform, const FMounteaInteractableConfigFragment& Config, const FMounteaInteractableFragment& Fragment)
+{
+	UWorld* world = GetWorld();
+
+	FActorSpawnParameters spawnParameters;
+	spawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	spawnParameters.ObjectFlags |= RF_Transient;
+
+	AMounteaInteractableMassProxy* proxy = world->SpawnActor<AMounteaInteractableMassProxy>(AMounteaInteractableMassProxy::StaticClass(), Transform, spawnParameters);
+	if (proxy == nullptr)
+	{
+		return;
+	}
+
+	proxy->InitializeProxy(Entity, Config, Fragment);
+	PromotedProxies.Add(Entity, proxy);
+
+	// Tag is added once Mass flushes commands, Promoted Proxies guard against double promotion meanwhile
+	FMassEntityManager& entityManager = world->GetSubsystem<UMassEntitySubsystem>()->GetMutableEntityManager();
+	entityManager.Defer().AddTag<FMounteaInteractablePromotedTag>(Entity);
+
+	INC_DWORD_STAT(STAT_MounteaInteraction_MassPromotions);
+}
+
+FMassEntityHandle UMounteaInteractableMassSubsystem::CreateInteractableEntity(const FTransform& Transform, const FMounteaInteractableConfigFragment& Config, const int32 Weight)
+{
+	UMassEntitySubsystem* entitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+	if (entitySubsystem == nullptr)
+	{
+		return FMassEntityHandle();
+	}
+
+	FMassEntityManager& entityManager = entitySubsystem->GetMutableEntityManager();
+
+	FTransformFragment transformFragment;
+	transformFragment.SetTransform(Transform);
+
+	FMounteaInteractableFragment interactableFragment;
+	interactableFragment.State = Config.DefaultState;
+	interactableFragment.Weight = Weight;
+	interactableFragment.RemainingLifecycleCount = Config.GetArchetypeSettings().LifecycleCount;
+
+	const FConstSharedStruct& sharedConfig = entityManager.GetOrCreateConstSharedFragment(Config);
+
+	FMassArchetypeSharedFragmentValues sharedValues;
+	sharedValues.AddConstSharedFragment(sharedConfig);
+	sharedValues.Sort();
+
+	const TArray<FInstancedStruct> fragments =
+	{
+		FInstancedStruct::Make(transformFragment),
+		FInstancedStruct::Make(interactableFragment)
+	};
+
+	return entityManager.CreateEntity(fragments, sharedValues);
+}
+
+AMounteaInteractableMassProxy* UMounteaInteractableMassSubsystem::FindProxy(const FMassEntityHandle& Entity) const
+{
+	const TObjectPtr<AMounteaInteractableMassProxy>* proxy = PromotedProxies.Find(Entity);
+	return proxy && IsValid(*proxy) ? proxy->Get() : nullptr;
+}
+
+void UMounteaInteractableMassSubsystem::ReleaseProxy(const FMassEntityHandle& Entity)
+{
+	TObjectPtr<AMounteaInteractableMassProxy> proxy;
+	if (!PromotedProxies.RemoveAndCopyValue(Entity, proxy))
+	{
+		return;
+	}
+
+	if (IsValid(proxy))
+	{
+		proxy->Destroy();
+	}
+
+	INC_DWORD_STAT(STAT_MounteaInteraction_MassDemotions);
+}
@@ -0,0 +1,21 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "Mass/MounteaInteractableMassTrait.h"
+
+#include "MassCommonFragments.h"
+#include "MassEntityManager.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+void UMounteaInteractableMassTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.AddFragment<FTransformFragment>();
+
+	FMounteaInteractableFragment& interactableFragment = BuildContext.AddFragment_GetRef<FMounteaInteractableFragment>();
+	interactableFragment.State = Config.DefaultState;
+	interactableFragment.Weight = InteractionWeight;
+	interactableFragment.RemainingLifecycleCount = Config.GetArchetypeSettings().LifecycleCount;
+
+	FMassEntityManager& entityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+	BuildContext.AddConstSharedFragment(entityManager.GetOrCreateConstSharedFragment(Config));
+}
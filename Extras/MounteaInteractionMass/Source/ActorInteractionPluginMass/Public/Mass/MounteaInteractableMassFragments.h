@@ -0,0 +1,121 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+
+#include "Components/Interactable/ActorInteractableComponentBase.h"
+#include "Helpers/InteractionHelpers.h"
+#include "Helpers/MounteaInteractableArchetype.h"
+
+#include "MounteaInteractableMassFragments.generated.h"
+
+/**
+ * Mutable state of one Interactable Entity.
+ * Mirrors runtime values of Interactable Component, so Entity can be promoted and demoted without losing progress.
+ */
+USTRUCT()
+struct ACTORINTERACTIONPLUGINMASS_API FMounteaInteractableFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	EInteractableStateV2																					State = EInteractableStateV2::EIS_Awake;
+
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	int32																												Weight = 1;
+
+	/**
+	 * -1 means unlimited Lifecycles.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	int32																												RemainingLifecycleCount = -1;
+
+	UPROPERTY()
+	float																													CooldownRemaining = 0.f;
+
+	/**
+	 * How long promoted Entity has been without engaged Interactor.
+	 */
+	UPROPERTY()
+	float																													IdleTime = 0.f;
+};
+
+/**
+ * Configuration shared by every Entity created from the same Trait.
+ * Compatible Tags, Lifecycle and Cooldown settings are read from Archetype, they are not duplicated per Entity.
+ */
+USTRUCT()
+struct ACTORINTERACTIONPLUGINMASS_API FMounteaInteractableConfigFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	/**
+	 * Interactable Component class spawned when Entity is promoted.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea", meta=(AllowAbstract=false))
+	TSubclassOf<UActorInteractableComponentBase>											InteractableClass;
+
+	/**
+	 * Archetype assigned to promoted Interactable Component.
+	 * Could be nullptr, then class defaults are used.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	TObjectPtr<UMounteaInteractableArchetype>												InteractableArchetype = nullptr;
+
+	/**
+	 * Radius of Collision Shape of promoted Interactable.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea", meta=(UIMin=1.f, ClampMin=1.f, Units="cm"))
+	float																													InteractionRadius = 50.f;
+
+	/**
+	 * State Entity returns to once Cooldown is finished.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	EInteractableStateV2																					DefaultState = EInteractableStateV2::EIS_Awake;
+
+	/**
+	 * How long promoted Entity stays promoted without engaged Interactor.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea", meta=(UIMin=0.f, ClampMin=0.f, Units="seconds"))
+	float																													DemotionDelay = 1.f;
+
+	/**
+	 * Distance beyond Interaction Radius within which Interactor queries keep Entity promoted.
+	 * Avoids promoting and demoting the same Entity over and over while Interactor moves along the edge.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea", meta=(UIMin=0.f, ClampMin=0.f, Units="cm"))
+	float																													DemotionDistance = 100.f;
+
+	/**
+	 * Whether Entity is destroyed once its Lifecycle is Completed.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	bool																													bDestroyWhenCompleted = true;
+
+	/**
+	 * Returns Archetype Settings promoted Interactable will use.
+	 */
+	const FInteractableArchetypeSettings& GetArchetypeSettings() const
+	{
+		if (InteractableArchetype)
+		{
+			return InteractableArchetype->Settings;
+		}
+
+		const UClass* interactableClass = InteractableClass ? InteractableClass.Get() : UActorInteractableComponentBase::StaticClass();
+		return interactableClass->GetDefaultObject<UActorInteractableComponentBase>()->GetArchetypeSettings();
+	}
+};
+
+/**
+ * Entity is currently represented by Interactable Component.
+ * Processors leave promoted Entities to the Component until they are demoted.
+ */
+USTRUCT()
+struct ACTORINTERACTIONPLUGINMASS_API FMounteaInteractablePromotedTag : public FMassTag
+{
+	GENERATED_BODY()
+};
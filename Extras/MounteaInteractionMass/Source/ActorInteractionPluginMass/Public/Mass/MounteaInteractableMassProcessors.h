@@ -0,0 +1,112 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassObserverProcessor.h"
+#include "MassEntityQuery.h"
+#include "MounteaInteractableMassProcessors.generated.h"
+
+/**
+ * Counts down Cooldown of not promoted Interactable Entities.
+ * Entity returns to its Default State once Cooldown is finished.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableCooldownProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInteractableCooldownProcessor();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery																						EntityQuery;
+};
+
+/**
+ * Completes not promoted Interactable Entities without remaining Lifecycles.
+ * Completed Entities are destroyed if their configuration asks for it.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableLifecycleProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInteractableLifecycleProcessor();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery																						EntityQuery;
+};
+
+/**
+ * Demotes promoted Interactable Entities without engaged Interactor and without Interactor queries within Demotion Distance.
+ * Interactable Component state is written back to Entity before its Proxy is destroyed.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableDemotionProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInteractableDemotionProcessor();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery																						EntityQuery;
+};
+
+/**
+ * Adds created Interactable Entities to promotion grid of Mountea Interactable Mass Subsystem.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableGridAddObserver : public UMassObserverProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInteractableGridAddObserver();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery																						EntityQuery;
+};
+
+/**
+ * Removes destroyed Interactable Entities from promotion grid of Mountea Interactable Mass Subsystem.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableGridRemoveObserver : public UMassObserverProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UMounteaInteractableGridRemoveObserver();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery																						EntityQuery;
+};
@@ -0,0 +1,73 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MassEntityHandle.h"
+#include "MounteaInteractableMassProxy.generated.h"
+
+class USphereComponent;
+class UActorInteractableComponentBase;
+struct FMounteaInteractableFragment;
+struct FMounteaInteractableConfigFragment;
+
+/**
+ * Lightweight Actor representing promoted Interactable Entity.
+ *
+ * Owns only a Collision Sphere and Interactable Component, so Interactors handle it the same way as any other Interactable.
+ * Spawned and destroyed by Mountea Interactable Mass Subsystem, never place it manually.
+ */
+UCLASS(NotPlaceable, Transient, NotBlueprintable)
+class ACTORINTERACTIONPLUGINMASS_API AMounteaInteractableMassProxy : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	AMounteaInteractableMassProxy();
+
+	/**
+	 * Creates Interactable Component from Entity configuration and continues Entity state.
+	 */
+	void InitializeProxy(const FMassEntityHandle& NewEntityHandle, const FMounteaInteractableConfigFragment& Config, const FMounteaInteractableFragment& Fragment);
+
+	/**
+	 * Writes current Interactable Component state back to Entity Fragment.
+	 */
+	void WriteFragment(FMounteaInteractableFragment& Fragment) const;
+
+	/**
+	 * Returns whether any Interactor is engaged with Interactable Component.
+	 */
+	bool IsEngaged() const;
+
+	/**
+	 * Called whenever Interactor queries within Demotion Distance, Proxy is not demoted while queried.
+	 */
+	void KeepPromoted();
+
+	/**
+	 * Returns World time of last query within Demotion Distance.
+	 */
+	float GetKeepPromotedTime() const
+	{ return KeepPromotedTime; };
+
+	FMassEntityHandle GetEntityHandle() const
+	{ return EntityHandle; };
+
+	UActorInteractableComponentBase* GetInteractable() const
+	{ return Interactable; };
+
+protected:
+
+	UPROPERTY(VisibleAnywhere, Category="Mountea")
+	TObjectPtr<USphereComponent>																CollisionSphere;
+
+	UPROPERTY(VisibleAnywhere, Category="Mountea")
+	TObjectPtr<UActorInteractableComponentBase>											Interactable;
+
+	FMassEntityHandle																						EntityHandle;
+
+	float																													KeepPromotedTime = 0.f;
+};
@@ -0,0 +1,13 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/MounteaInteractionStats.h"
+
+// Shares `stat MounteaInteraction` group with core module
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mass Promotion Query"), STAT_MounteaInteraction_MassPromotionQuery, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGINMASS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mass Promotions"), STAT_MounteaInteraction_MassPromotions, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGINMASS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mass Demotions"), STAT_MounteaInteraction_MassDemotions, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGINMASS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Mass Grid Entities"), STAT_MounteaInteraction_MassGridEntities, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGINMASS_API);
@@ -0,0 +1,105 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityHandle.h"
+#include "Helpers/MounteaInteractableProviderSubsystem.h"
+#include "MounteaInteractableMassSubsystem.generated.h"
+
+class AMounteaInteractableMassProxy;
+struct FMounteaInteractableConfigFragment;
+struct FMounteaInteractableFragment;
+
+/**
+ * Provides Interactables stored as Mass Entities.
+ *
+ * Entities keep only Interactable Fragments. Once Interactor queries close to an Awake Entity, the Entity is promoted
+ * to Proxy Actor with regular Interactable Component. Demotion Processor writes Component state back and destroys
+ * the Proxy once no Interactor is engaged nor queries within Demotion Distance for Demotion Delay.
+ *
+ * Interactable Entities are static, they are kept in uniform 2D grid so queries only visit Entities in cells they touch.
+ *
+ * Promotion and demotion happen on Server only, Proxies replicate to Clients as regular Actors.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableMassSubsystem : public UMounteaInteractableProviderSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void PromoteInteractables(const FVector& Start, const FVector& End, const float Radius, const TScriptInterface<IActorInteractorInterface>& Interactor) override;
+
+	/**
+	 * Creates Interactable Entity at Transform.
+	 * Alternative to Mass Spawner with Mountea Interactable Trait.
+	 */
+	FMassEntityHandle CreateInteractableEntity(const FTransform& Transform, const FMounteaInteractableConfigFragment& Config, const int32 Weight = 1);
+
+	/**
+	 * Returns Proxy of promoted Entity.
+	 * Could be nullptr, then Entity is not promoted.
+	 */
+	AMounteaInteractableMassProxy* FindProxy(const FMassEntityHandle& Entity) const;
+
+	/**
+	 * Destroys Proxy of promoted Entity.
+	 * Does not touch Entity, caller is responsible for writing state back and removing Promoted Tag.
+	 */
+	void ReleaseProxy(const FMassEntityHandle& Entity);
+
+	int32 GetPromotedCount() const
+	{ return PromotedProxies.Num(); };
+
+	/**
+	 * Adds Entity to promotion grid, called by Grid Observer once Interactable Fragment is added.
+	 */
+	void AddToGrid(const FMassEntityHandle& Entity, const FVector& Location, const FMounteaInteractableConfigFragment& Config);
+
+	/**
+	 * Removes Entity from promotion grid, called by Grid Observer once Interactable Fragment is removed.
+	 */
+	void RemoveFromGrid(const FMassEntityHandle& Entity);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void PromoteEntity(const FMassEntityHandle& Entity, const FTransform& Transform, const FMounteaInteractableConfigFragment& Config, const FMounteaInteractableFragment& Fragment);
+
+	static FIntPoint GetGridCell(const FVector& Location)
+	{ return FIntPoint(FMath::FloorToInt32(Location.X / GridCellSize), FMath::FloorToInt32(Location.Y / GridCellSize)); };
+
+protected:
+
+	struct FGridEntity
+	{
+		FMassEntityHandle Entity;
+		FVector Location;
+
+		/**
+		 * Stays valid while any Entity uses it, Entities are removed from grid before they are destroyed.
+		 */
+		const FMounteaInteractableConfigFragment* Config = nullptr;
+	};
+
+	/**
+	 * Size of grid cell, larger than common Interaction Radius so most queries touch only few cells.
+	 */
+	static constexpr float																					GridCellSize = 1000.f;
+
+	TMap<FIntPoint, TArray<FGridEntity>>																	GridCells;
+	TMap<FMassEntityHandle, FIntPoint>																	GridEntityCells;
+
+	/**
+	 * Largest Interaction Radius plus Demotion Distance of any Entity in grid, queries are extended by it.
+	 */
+	float																													MaxGridEntityReach = 0.f;
+
+	UPROPERTY(Transient)
+	TMap<FMassEntityHandle, TObjectPtr<AMounteaInteractableMassProxy>>			PromotedProxies;
+};
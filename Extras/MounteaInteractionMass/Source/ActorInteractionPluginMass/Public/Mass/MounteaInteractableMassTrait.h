@@ -0,0 +1,35 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "Mass/MounteaInteractableMassFragments.h"
+#include "MounteaInteractableMassTrait.generated.h"
+
+/**
+ * Makes Mass Entity an Interactable.
+ *
+ * Entities share one Config Fragment per Trait, only mutable state is stored per Entity.
+ * Entities are promoted to Interactable Components by Mountea Interactable Mass Subsystem once Interactor gets close.
+ */
+UCLASS(meta=(DisplayName="Mountea Interactable"))
+class ACTORINTERACTIONPLUGINMASS_API UMounteaInteractableMassTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+
+protected:
+
+	UPROPERTY(EditAnywhere, Category="Mountea", meta=(ShowOnlyInnerProperties))
+	FMounteaInteractableConfigFragment														Config;
+
+	/**
+	 * Initial Interactable Weight of spawned Entities.
+	 */
+	UPROPERTY(EditAnywhere, Category="Mountea")
+	int32																												InteractionWeight = 1;
+};
@@ -3,8 +3,11 @@
 #include "ActorInteractionPlugin.h"
 
 #include "GameplayTagsManager.h"
+#include "Helpers/MounteaInteractableArchetype.h"
+#include "Helpers/MounteaInteractionTagBits.h"
 #include "Interfaces/IPluginManager.h"
 #include "Styling/SlateStyleRegistry.h"
+#include "UObject/UObjectGlobals.h"
 
 #define LOCTEXT_NAMESPACE "FActorInteractionPluginModule"
 
@@ -16,12 +19,32 @@ void FActorInteractionPluginModule::StartupModule()
 	check(ThisPlugin.IsValid());
 	
 	UGameplayTagsManager::Get().AddTagIniSearchPath(ThisPlugin->GetBaseDir() / TEXT("Config") / TEXT("Tags"));
+
+#if WITH_EDITOR
+	// Tags added or removed in Editor shift Interaction Tag bits
+	GameplayTagTreeChangedHandle = UGameplayTagsManager::Get().OnEditorRefreshGameplayTagTree.AddStatic(&FMounteaInteractionTagBits::Invalidate);
+
+	// Recompiled Blueprint Interactors replace their Classes, resolved Ignored Classes would point to the old ones
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		UMounteaInteractableArchetype::InvalidateResolvedClasses();
+	});
+#endif
 }
 
 void FActorInteractionPluginModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+#if WITH_EDITOR
+	if (UObjectInitialized() && GameplayTagTreeChangedHandle.IsValid())
+	{
+		UGameplayTagsManager::Get().OnEditorRefreshGameplayTagTree.Remove(GameplayTagTreeChangedHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -13,9 +13,14 @@ UActorInteractableComponentAutomatic::UActorInteractableComponentAutomatic()
 	InteractableName = NSLOCTEXT("ActorInteractableComponentAutomatic", "Auto", "Auto");
 
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
-	InteractionPeriod = 1.f;
+}
+
+void UActorInteractableComponentAutomatic::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
+{
+	Super::InitializeArchetypeDefaults(Settings);
 
-	bInteractionHighlight = false;
+	Settings.InteractionPeriod = 1.f;
+	Settings.bInteractionHighlight = false;
 }
 
 void UActorInteractableComponentAutomatic::BeginPlay()
@@ -34,7 +39,7 @@ void UActorInteractableComponentAutomatic::InteractableSelected_Implementation(c
 	{
 		if (GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction) == false)
 		{
-			OnInteractionStarted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+			NotifyInteractionStarted(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 		}
 	}
 }
@@ -46,7 +51,7 @@ void UActorInteractableComponentAutomatic::InteractionStarted_Implementation(con
 	if (Execute_CanInteract(this) && !GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction))
 	{
 		// Force Interaction Period to be at least 0.01s
-		const float TempInteractionPeriod = FMath::Max(0.01f, InteractionPeriod);
+		const float TempInteractionPeriod = FMath::Max(0.01f, GetArchetypeSettings().InteractionPeriod);
 		
 		FTimerDelegate Delegate;
 		Delegate.BindUObject(this, &UActorInteractableComponentAutomatic::OnInteractionCompletedCallback);
@@ -94,17 +99,17 @@ void UActorInteractableComponentAutomatic::OnInteractionCompletedCallback()
 {
 	if (!GetWorld())
 	{
-		OnInteractionCanceled.Broadcast();
+		NotifyInteractionCanceled();
 		return;
 	}
 
 	Execute_ToggleWidgetVisibility(this, false);
-	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
+	if (GetArchetypeSettings().LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 	{
 		if (Execute_TriggerCooldown(this)) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+	NotifyInteractionCompleted(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 }
 
 #undef LOCTEXT_NAMESPACE
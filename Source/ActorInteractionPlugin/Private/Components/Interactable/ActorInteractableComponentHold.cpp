@@ -6,18 +6,23 @@
 #include "Interfaces/ActorInteractorInterface.h"
 #include "TimerManager.h"
 #include "Helpers/ActorInteractionPluginLog.h"
-#include "Helpers/MounteaInteractionSystemBFL.h"
 
 #define LOCTEXT_NAMESPACE "InteractableComponentHold"
 
 UActorInteractableComponentHold::UActorInteractableComponentHold()
 {
-	bInteractionHighlight = true;
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
-	InteractionPeriod = 3.f;
 	InteractableName = NSLOCTEXT("InteractableComponentHold", "Hold", "Hold");
 }
 
+void UActorInteractableComponentHold::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
+{
+	Super::InitializeArchetypeDefaults(Settings);
+
+	Settings.bInteractionHighlight = true;
+	Settings.InteractionPeriod = 3.f;
+}
+
 void UActorInteractableComponentHold::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
@@ -28,10 +33,11 @@ void UActorInteractableComponentHold::InteractionStarted_Implementation(const fl
 			return;
 		
 		// Force Interaction Period to be at least 0.1s
-		const float TempInteractionPeriod = FMath::Max(0.1f, InteractionPeriod);
+		const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+		const float TempInteractionPeriod = FMath::Max(0.1f, archetypeSettings.InteractionPeriod);
 
 		// Either unpause or start from start
-		if (bCanPersist && GetWorld()->GetTimerManager().IsTimerPaused(Timer_Interaction))
+		if (archetypeSettings.bCanPersist && GetWorld()->GetTimerManager().IsTimerPaused(Timer_Interaction))
 		{
 			GetWorld()->GetTimerManager().UnPauseTimer(Timer_Interaction);
 		}
@@ -60,25 +66,18 @@ void UActorInteractableComponentHold::OnInteractionCompletedCallback()
 		if (!GetWorld())
 		{
 			LOG_WARNING(TEXT("[OnInteractionCompletedCallback] No World, this is bad!"))
-			OnInteractionCanceled.Broadcast();
+			NotifyInteractionCanceled();
 			return;
 		}
 
-		if (UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
-		{
-			ProcessToggleActive(false);
-		}
-		else
-		{
-			ProcessToggleActive_Client(false);
-		}
+		ProcessToggleActive(false);
 		
-		if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
+		if (GetArchetypeSettings().LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 		{
 			if (Execute_TriggerCooldown(this)) return;
 		}
 	
-		OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+		NotifyInteractionCompleted(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 	}
 }
 
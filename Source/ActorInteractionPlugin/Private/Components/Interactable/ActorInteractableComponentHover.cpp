@@ -7,57 +7,68 @@
 
 UActorInteractableComponentHover::UActorInteractableComponentHover()
 {
-	bInteractionHighlight = true;
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
-	InteractionPeriod = 3.f;
 	InteractableName = NSLOCTEXT("ActorInteractableComponentHover", "Hover", "Hover");
 }
 
-void UActorInteractableComponentHover::BeginPlay()
+void UActorInteractableComponentHover::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
 {
-	Super::BeginPlay();
+	Super::InitializeArchetypeDefaults(Settings);
 
-	OnInteractorOverlapped.										RemoveDynamic(this, &UActorInteractableComponentHover::OnInteractableBeginOverlapEvent);
-	OnInteractorStopOverlap.										RemoveDynamic(this, &UActorInteractableComponentHover::OnInteractableStopOverlapEvent);
-	OnInteractorTraced.												RemoveDynamic(this, &UActorInteractableComponentHover::OnInteractableTracedEvent);
+	Settings.bInteractionHighlight = true;
+	Settings.InteractionPeriod = 3.f;
 }
 
-void UActorInteractableComponentHover::BindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
+void UActorInteractableComponentHover::NotifyInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	Super::BindCollisionShape_Implementation(PrimitiveComponent);
+	// Hover is driven by cursor, overlaps are only forwarded to listeners
+	OnInteractorOverlapped.Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+}
 
-	if (PrimitiveComponent)
-	{
-		PrimitiveComponent->OnBeginCursorOver.		AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
-		PrimitiveComponent->OnEndCursorOver.			AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
-	}
+void UActorInteractableComponentHover::NotifyInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	OnInteractorStopOverlap.Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
 }
 
-void UActorInteractableComponentHover::UnbindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
+void UActorInteractableComponentHover::BindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const
 {
-	Super::UnbindCollisionShape_Implementation(PrimitiveComponent);
+	Super::BindCollisionShapeDelegates(PrimitiveComponent);
 
-	if (PrimitiveComponent)
-	{
-		PrimitiveComponent->OnBeginCursorOver.		RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
-		PrimitiveComponent->OnEndCursorOver.			RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
-	}
+	PrimitiveComponent->OnBeginCursorOver.		AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
+	PrimitiveComponent->OnEndCursorOver.			AddUniqueDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
 }
 
-bool UActorInteractableComponentHover::CanInteract_Implementation() const
+void UActorInteractableComponentHover::UnbindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const
 {
-	return Super::CanInteract_Implementation() && OverlappingComponent != nullptr;
+	Super::UnbindCollisionShapeDelegates(PrimitiveComponent);
+
+	PrimitiveComponent->OnBeginCursorOver.		RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverBeginsEvent);
+	PrimitiveComponent->OnEndCursorOver.			RemoveDynamic(this, &UActorInteractableComponentHover::OnHoverStopsEvent);
+}
+
+EInteractableTriggerFlags UActorInteractableComponentHover::ComputeTriggerFlags() const
+{
+	EInteractableTriggerFlags triggerFlags = Super::ComputeTriggerFlags();
+	if (OverlappingComponent == nullptr)
+	{
+		triggerFlags &= ~EInteractableTriggerFlags::EITF_CanInteract;
+	}
+	return triggerFlags;
 }
 
 void UActorInteractableComponentHover::OnHoverBeginsEvent(UPrimitiveComponent* PrimitiveComponent)
 {
+	if (!IsCollisionShapeActive(PrimitiveComponent)) return;
+	
 	OverlappingComponent = PrimitiveComponent;
+	RefreshTriggerFlags();
 	OnCursorBeginsOverlap.Broadcast(PrimitiveComponent);
 }
 
 void UActorInteractableComponentHover::OnHoverStopsEvent(UPrimitiveComponent* PrimitiveComponent)
 {
 	OverlappingComponent = nullptr;
+	RefreshTriggerFlags();
 	OnCursorStopsOverlap.Broadcast(PrimitiveComponent);
 }
 
@@ -0,0 +1,344 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Components/Interactable/ActorInteractableComponentInstanced.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Interfaces/ActorInteractorInterface.h"
+
+#include "Net/UnrealNetwork.h"
+
+#define LOCTEXT_NAMESPACE "InteractableComponentInstanced"
+
+void FInteractableCompletedInstance::PostReplicatedAdd(const FInteractableCompletedInstances& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HideInstance(InstanceIndex);
+	}
+}
+
+UActorInteractableComponentInstanced::UActorInteractableComponentInstanced()
+{
+	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
+	InteractableName = NSLOCTEXT("InteractableComponentInstanced", "Instanced", "Instanced");
+
+	CompletedInstances.Owner = this;
+}
+
+void UActorInteractableComponentInstanced::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
+{
+	Super::InitializeArchetypeDefaults(Settings);
+
+	// Highlight applies to the whole mesh, not to single Instance
+	Settings.bInteractionHighlight = false;
+	Settings.InteractionPeriod = 1.f;
+	Settings.LifecycleMode = EInteractableLifecycle::EIL_OnlyOnce;
+}
+
+void UActorInteractableComponentInstanced::BeginPlay()
+{
+	CompletedInstances.Owner = this;
+
+	Super::BeginPlay();
+
+	if (InstancedMesh == nullptr)
+	{
+		SetInstancedMesh(FindInstancedMesh());
+	}
+
+	if (InstancedMesh == nullptr)
+	{
+		LOG_ERROR(TEXT("[%s] Has no Instanced Static Mesh, no Instance can be interacted with!"), *GetName())
+		return;
+	}
+
+	// Late joining Clients hide Instances replicated before BeginPlay
+	for (const FInteractableCompletedInstance& completedInstance : CompletedInstances.Items)
+	{
+		HideInstance(completedInstance.InstanceIndex);
+	}
+}
+
+void UActorInteractableComponentInstanced::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UActorInteractableComponentInstanced, CompletedInstances);
+}
+
+void UActorInteractableComponentInstanced::SetInstancedMesh(UInstancedStaticMeshComponent* NewInstancedMesh)
+{
+	if (NewInstancedMesh == InstancedMesh)
+	{
+		return;
+	}
+
+	InstancedMesh = NewInstancedMesh;
+	TargetInstance = INDEX_NONE;
+
+	InstanceStates.Reset();
+	InstanceRemainingLifecycles.Reset();
+	InstanceCooldownEnds.Reset();
+
+	if (InstancedMesh)
+	{
+		Execute_AddCollisionComponent(this, InstancedMesh);
+		UpdateInstanceCount(InstancedMesh->GetInstanceCount());
+	}
+}
+
+UInstancedStaticMeshComponent* UActorInteractableComponentInstanced::FindInstancedMesh() const
+{
+	for (UPrimitiveComponent* collisionComponent : CollisionComponents)
+	{
+		if (UInstancedStaticMeshComponent* instancedComponent = Cast<UInstancedStaticMeshComponent>(collisionComponent))
+		{
+			return instancedComponent;
+		}
+	}
+
+	return GetOwner() ? GetOwner()->FindComponentByClass<UInstancedStaticMeshComponent>() : nullptr;
+}
+
+void UActorInteractableComponentInstanced::UpdateInstanceCount(const int32 InstanceCount)
+{
+	const int32 previousCount = InstanceStates.Num();
+	if (InstanceCount <= previousCount)
+	{
+		return;
+	}
+
+	const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+	const bool bCycled = archetypeSettings.LifecycleMode == EInteractableLifecycle::EIL_Cycled;
+
+	InstanceStates.SetNum(InstanceCount);
+	for (int32 instanceIndex = previousCount; instanceIndex < InstanceCount; instanceIndex++)
+	{
+		InstanceStates[instanceIndex] = EInteractableStateV2::EIS_Awake;
+	}
+
+	if (bCycled && archetypeSettings.LifecycleCount != -1)
+	{
+		InstanceRemainingLifecycles.SetNum(InstanceCount);
+		for (int32 instanceIndex = previousCount; instanceIndex < InstanceCount; instanceIndex++)
+		{
+			InstanceRemainingLifecycles[instanceIndex] = archetypeSettings.LifecycleCount;
+		}
+	}
+
+	if (bCycled)
+	{
+		InstanceCooldownEnds.SetNumZeroed(InstanceCount);
+	}
+}
+
+EInteractableStateV2 UActorInteractableComponentInstanced::GetInstanceState(const int32 InstanceIndex) const
+{
+	if (!InstanceStates.IsValidIndex(InstanceIndex))
+	{
+		return EInteractableStateV2::Default;
+	}
+
+	const EInteractableStateV2 instanceState = InstanceStates[InstanceIndex];
+	if (instanceState == EInteractableStateV2::EIS_Cooldown && GetWorld() && InstanceCooldownEnds.IsValidIndex(InstanceIndex))
+	{
+		return GetWorld()->GetTimeSeconds() >= InstanceCooldownEnds[InstanceIndex] ? EInteractableStateV2::EIS_Awake : instanceState;
+	}
+
+	return instanceState;
+}
+
+int32 UActorInteractableComponentInstanced::GetInstanceRemainingLifecycleCount(const int32 InstanceIndex) const
+{
+	return InstanceRemainingLifecycles.IsValidIndex(InstanceIndex) ? InstanceRemainingLifecycles[InstanceIndex] : INDEX_NONE;
+}
+
+bool UActorInteractableComponentInstanced::IsInstanceAvailable(const int32 InstanceIndex) const
+{
+	// Instances added after last update are Awake
+	if (InstanceIndex >= InstanceStates.Num())
+	{
+		return InstancedMesh && InstanceIndex < InstancedMesh->GetInstanceCount();
+	}
+
+	return GetInstanceState(InstanceIndex) == EInteractableStateV2::EIS_Awake;
+}
+
+bool UActorInteractableComponentInstanced::CanBeTriggeredByHit(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor) const
+{
+	// Other Collision Components address the whole Interactable
+	if (InstancedMesh == nullptr || Hit.GetComponent() != InstancedMesh)
+	{
+		return true;
+	}
+
+	// Interactor is shared by all Instances, nobody else can target any Instance meanwhile
+	const UObject* currentInteractor = Execute_GetInteractor(this).GetObject();
+	if (currentInteractor && currentInteractor != TargetingInteractor.GetObject())
+	{
+		return false;
+	}
+
+	return Hit.Item != INDEX_NONE && IsInstanceAvailable(Hit.Item);
+}
+
+void UActorInteractableComponentInstanced::NotifyHitTargeted(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor)
+{
+	if (InstancedMesh == nullptr || Hit.GetComponent() != InstancedMesh || Hit.Item == INDEX_NONE)
+	{
+		return;
+	}
+
+	UpdateInstanceCount(InstancedMesh->GetInstanceCount());
+
+	// Resolve finished Cooldown lazily
+	if (InstanceStates.IsValidIndex(Hit.Item) && InstanceStates[Hit.Item] == EInteractableStateV2::EIS_Cooldown && IsInstanceAvailable(Hit.Item))
+	{
+		InstanceStates[Hit.Item] = EInteractableStateV2::EIS_Awake;
+	}
+
+	if (TargetingInteractor.GetObject())
+	{
+		InteractorTargetInstances.Add(TargetingInteractor.GetObject(), Hit.Item);
+	}
+
+	// Running Interaction keeps its Instance
+	if (InteractableState == EInteractableStateV2::EIS_Active || InteractableState == EInteractableStateV2::EIS_Paused)
+	{
+		return;
+	}
+
+	// Only Interactor which owns this Interactable moves its Target Instance
+	const UObject* currentInteractor = Execute_GetInteractor(this).GetObject();
+	if (currentInteractor == nullptr || currentInteractor == TargetingInteractor.GetObject())
+	{
+		TargetInstance = Hit.Item;
+	}
+}
+
+void UActorInteractableComponentInstanced::InteractorLost_Implementation(const TScriptInterface<IActorInteractorInterface>& LostInteractor)
+{
+	InteractorTargetInstances.Remove(LostInteractor.GetObject());
+
+	if (LostInteractor.GetObject() && LostInteractor.GetObject() == Execute_GetInteractor(this).GetObject())
+	{
+		TargetInstance = INDEX_NONE;
+	}
+
+	Super::InteractorLost_Implementation(LostInteractor);
+}
+
+void UActorInteractableComponentInstanced::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	// Interaction applies to Instance targeted by Interactor which started it, resumed Interaction keeps its Instance
+	const int32* targetedInstance = InteractableState != EInteractableStateV2::EIS_Paused ? InteractorTargetInstances.Find(CausingInteractor.GetObject()) : nullptr;
+	if (targetedInstance)
+	{
+		if (!IsInstanceAvailable(*targetedInstance))
+		{
+			LOG_WARNING(TEXT("[InteractionStarted] %s rejected Instance %d which is not available"), *GetName(), *targetedInstance)
+			return;
+		}
+
+		TargetInstance = *targetedInstance;
+	}
+
+	Super::InteractionStarted_Implementation(TimeStarted, CausingInteractor);
+}
+
+bool UActorInteractableComponentInstanced::TriggerCooldown_Implementation()
+{
+	if (!InstanceStates.IsValidIndex(TargetInstance) || !GetWorld())
+	{
+		return Super::TriggerCooldown_Implementation();
+	}
+
+	int32 remainingLifecycleCount = INDEX_NONE;
+	if (InstanceRemainingLifecycles.IsValidIndex(TargetInstance))
+	{
+		InstanceRemainingLifecycles[TargetInstance] = FMath::Max(0, InstanceRemainingLifecycles[TargetInstance] - 1);
+		remainingLifecycleCount = InstanceRemainingLifecycles[TargetInstance];
+
+		// Caller completes the Instance
+		if (remainingLifecycleCount == 0) return false;
+	}
+
+	InstanceStates[TargetInstance] = EInteractableStateV2::EIS_Cooldown;
+	if (InstanceCooldownEnds.IsValidIndex(TargetInstance))
+	{
+		InstanceCooldownEnds[TargetInstance] = GetWorld()->GetTimeSeconds() + GetArchetypeSettings().CooldownPeriod;
+	}
+
+	const TScriptInterface<IActorInteractorInterface> causingInteractor = Execute_GetInteractor(this);
+	TargetInstance = INDEX_NONE;
+
+	// Component stays Awake for other Instances
+	Execute_SetState(this, EInteractableStateV2::EIS_Awake);
+
+	NotifyInteractionCycleCompleted(GetWorld()->GetTimeSeconds(), remainingLifecycleCount, causingInteractor);
+	return true;
+}
+
+void UActorInteractableComponentInstanced::InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (!InstanceStates.IsValidIndex(TargetInstance))
+	{
+		Super::InteractionCompleted_Implementation(TimeCompleted, CausingInteractor);
+		return;
+	}
+
+	Execute_ToggleWidgetVisibility(this, false);
+
+	CompleteInstance(TargetInstance);
+	TargetInstance = INDEX_NONE;
+
+	// Whole Interactable is Completed only once no Instance is left
+	if (CompletedInstances.Items.Num() >= InstanceStates.Num())
+	{
+		Super::InteractionCompleted_Implementation(TimeCompleted, CausingInteractor);
+		return;
+	}
+
+	Execute_SetState(this, EInteractableStateV2::EIS_Awake);
+	Execute_OnInteractionCompletedEvent(this, TimeCompleted, CausingInteractor);
+}
+
+void UActorInteractableComponentInstanced::CompleteInstance(const int32 InstanceIndex)
+{
+	if (!InstanceStates.IsValidIndex(InstanceIndex) || InstanceStates[InstanceIndex] == EInteractableStateV2::EIS_Completed)
+	{
+		return;
+	}
+
+	InstanceStates[InstanceIndex] = EInteractableStateV2::EIS_Completed;
+
+	FInteractableCompletedInstance& completedInstance = CompletedInstances.Items.AddDefaulted_GetRef();
+	completedInstance.InstanceIndex = InstanceIndex;
+	CompletedInstances.MarkItemDirty(completedInstance);
+
+	HideInstance(InstanceIndex);
+}
+
+void UActorInteractableComponentInstanced::HideInstance(const int32 InstanceIndex) const
+{
+	if (InstancedMesh == nullptr)
+	{
+		return;
+	}
+
+	FTransform instanceTransform;
+	if (!InstancedMesh->GetInstanceTransform(InstanceIndex, instanceTransform))
+	{
+		return;
+	}
+
+	// Zero scale hides Instance and removes its physics body, while Instance Indices stay stable
+	instanceTransform.SetScale3D(FVector::ZeroVector);
+	InstancedMesh->UpdateInstanceTransform(InstanceIndex, instanceTransform, false, true, true);
+}
+
+#undef LOCTEXT_NAMESPACE
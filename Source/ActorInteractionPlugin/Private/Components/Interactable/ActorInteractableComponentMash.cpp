@@ -4,7 +4,9 @@
 #include "Components/Interactable/ActorInteractableComponentMash.h"
 
 #include "TimerManager.h"
+#include "Helpers/ActorInteractionFunctionLibrary.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
 
 #define LOCTEXT_NAMESPACE "ActorInteractableComponentMash"
 
@@ -13,18 +15,28 @@ UActorInteractableComponentMash::UActorInteractableComponentMash() :
 		KeystrokeTimeThreshold(1.f),
 		ActualMashAmount(0)
 {
-	bInteractionHighlight = true;
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
-	InteractionPeriod = 3.f;
 	InteractableName = NSLOCTEXT("ActorInteractableComponentMash", "Mash", "Mash");
 }
 
-void UActorInteractableComponentMash::BeginPlay()
+void UActorInteractableComponentMash::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
 {
-	Super::BeginPlay();
+	Super::InitializeArchetypeDefaults(Settings);
 
-	OnInteractionFailed.		AddUniqueDynamic(this, &UActorInteractableComponentMash::InteractionFailed);
-	OnKeyMashed.				AddUniqueDynamic(this, &UActorInteractableComponentMash::OnKeyMashedEvent);
+	Settings.bInteractionHighlight = true;
+	Settings.InteractionPeriod = 3.f;
+}
+
+void UActorInteractableComponentMash::NotifyInteractionFailed()
+{
+	if (HasBegunPlay()) InteractionFailed();
+	OnInteractionFailed.Broadcast();
+}
+
+void UActorInteractableComponentMash::NotifyKeyMashed()
+{
+	if (HasBegunPlay()) OnKeyMashedEvent();
+	OnKeyMashed.Broadcast();
 }
 
 void UActorInteractableComponentMash::InteractionFailed()
@@ -38,7 +50,7 @@ void UActorInteractableComponentMash::InteractionFailed()
 
 void UActorInteractableComponentMash::OnInteractionFailedCallback()
 {
-	OnInteractionFailed.Broadcast();
+	NotifyInteractionFailed();
 }
 
 void UActorInteractableComponentMash::OnInteractionCompletedCallback()
@@ -50,19 +62,21 @@ void UActorInteractableComponentMash::OnInteractionCompletedCallback()
 
 	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
 	
-	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
+	if (GetArchetypeSettings().LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 	{
 		if (Execute_TriggerCooldown(this)) return;
 	}
 	
-	OnInteractionCompleted.Broadcast(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
+	NotifyInteractionCompleted(GetWorld()->GetTimeSeconds(), Execute_GetInteractor(this));
 }
 
 void UActorInteractableComponentMash::CleanupComponent()
 {
 	ActualMashAmount = 0;
+	KeyPressHead = 0;
+	KeyPressCount = 0;
 	
-	OnInteractableStateChanged.Broadcast(InteractableState);
+	NotifyInteractableStateChanged(InteractableState);
 	
 	if (GetWorld())
 	{
@@ -73,46 +87,151 @@ void UActorInteractableComponentMash::CleanupComponent()
 
 void UActorInteractableComponentMash::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
 {
-	Super::InteractionStarted_Implementation(TimeStarted, CausingInteractor);
-	
-	if (Execute_CanInteract(this))
+	// Timer is armed before Super, so presented Interaction Period is the clamped one
+	if (GetWorld() && GetOwner() && GetOwner()->HasAuthority() && Execute_CanInteract(this) && !GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction))
 	{
-		if(!GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction))
-		{
-			// Force Interaction Period to be at least 0.1s
-			const float TempInteractionPeriod = FMath::Max(0.1f, InteractionPeriod);
-	
-			FTimerDelegate Delegate_Completed;
-			Delegate_Completed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionCompletedCallback);
-
-			GetWorld()->GetTimerManager().SetTimer
-			(
-				Timer_Interaction,
-				Delegate_Completed,
-				TempInteractionPeriod,
-				false
-			);
-		}
+		// Force Interaction Period to be at least 0.1s
+		const float TempInteractionPeriod = FMath::Max(0.1f, GetArchetypeSettings().InteractionPeriod);
+
+		FTimerDelegate Delegate_Completed;
+		Delegate_Completed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionCompletedCallback);
 
-		if (GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(TimerHandle_Mashed);
-		}
-		
-		FTimerDelegate Delegate_Mashed;
-		Delegate_Mashed.BindUObject(this, &UActorInteractableComponentMash::OnInteractionFailedCallback);
 		GetWorld()->GetTimerManager().SetTimer
 		(
-			TimerHandle_Mashed,
-			Delegate_Mashed,
-			KeystrokeTimeThreshold,
+			Timer_Interaction,
+			Delegate_Completed,
+			TempInteractionPeriod,
 			false
 		);
-		
+	}
+
+	Super::InteractionStarted_Implementation(TimeStarted, CausingInteractor);
+
+	if (!Execute_CanInteract(this) || !GetWorld())
+	{
+		return;
+	}
+
+	// Clients predict Key presses for presentation, Server owns the timeline and outcome
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		ActualMashAmount++;
+		NotifyKeyMashed();
+		return;
+	}
+
+	const float lastPressTime = GetWorld()->GetTimeSeconds();
+	RegisterKeyPresses(PendingKeyPressCount, lastPressTime - PendingKeyPressSpan, lastPressTime);
+}
+
+bool UActorInteractableComponentMash::CanBatchInteractionStarts() const
+{
+	return InteractableState == EInteractableStateV2::EIS_Active;
+}
+
+void UActorInteractableComponentMash::NotifyInteractionStartsBatched(const int32 Count, const float FirstTime, const float LastTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	// Interaction Started is raised once per batch, Key Mashed once per press
+	PendingKeyPressCount = FMath::Max(1, Count);
+	PendingKeyPressSpan = FMath::Max(0.f, LastTime - FirstTime);
+
+	NotifyInteractionStarted(LastTime, CausingInteractor);
+
+	PendingKeyPressCount = 1;
+	PendingKeyPressSpan = 0.f;
+}
+
+void UActorInteractableComponentMash::RegisterKeyPresses(const int32 Count, const float FirstPressTime, const float LastPressTime)
+{
+	const float pressInterval = Count > 1 ? (LastPressTime - FirstPressTime) / (Count - 1) : 0.f;
+	const float maxGap = KeystrokeTimeThreshold + GetKeystrokeGracePeriod();
+
+	for (int32 pressIndex = 0; pressIndex < Count; pressIndex++)
+	{
+		const float pressTime = FirstPressTime + pressInterval * pressIndex;
+		if (KeyPressCount > 0 && pressTime - GetLastKeyPressTime() > maxGap)
+		{
+			OnInteractionFailedCallback();
+			return;
+		}
+
+		KeyPressTimes[KeyPressHead] = pressTime;
+		KeyPressHead = (KeyPressHead + 1) % KeyPressHistorySize;
+		KeyPressCount = FMath::Min(KeyPressCount + 1, KeyPressHistorySize);
+
 		ActualMashAmount++;
 
-		OnKeyMashed.Broadcast();
+		NotifyKeyMashed();
+	}
+
+	// Armed deadline only moves later with new presses, it re-arms itself once it fires
+	if (!GetWorld()->GetTimerManager().IsTimerActive(TimerHandle_Mashed))
+	{
+		ScheduleKeystrokeDeadline();
+	}
+}
+
+void UActorInteractableComponentMash::ScheduleKeystrokeDeadline()
+{
+	const float deadline = GetLastKeyPressTime() + KeystrokeTimeThreshold + GetKeystrokeGracePeriod();
+	const float delay = FMath::Max(deadline - GetWorld()->GetTimeSeconds(), UE_KINDA_SMALL_NUMBER);
+
+	FTimerDelegate Delegate_Mashed;
+	Delegate_Mashed.BindUObject(this, &UActorInteractableComponentMash::OnKeystrokeDeadline);
+	GetWorld()->GetTimerManager().SetTimer
+	(
+		TimerHandle_Mashed,
+		Delegate_Mashed,
+		delay,
+		false
+	);
+}
+
+void UActorInteractableComponentMash::OnKeystrokeDeadline()
+{
+	if (!GetWorld() || KeyPressCount == 0)
+	{
+		return;
+	}
+
+	const float deadline = GetLastKeyPressTime() + KeystrokeTimeThreshold + GetKeystrokeGracePeriod();
+	if (GetWorld()->GetTimeSeconds() + UE_KINDA_SMALL_NUMBER >= deadline)
+	{
+		OnInteractionFailedCallback();
+		return;
+	}
+
+	// Key was pressed meanwhile
+	ScheduleKeystrokeDeadline();
+}
+
+float UActorInteractableComponentMash::GetKeystrokeGracePeriod() const
+{
+	if (!GetWorld() || GetWorld()->GetNetMode() == NM_Standalone)
+	{
+		return 0.f;
+	}
+
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	return interactionSettings ? interactionSettings->GetInteractionStartBatchWindow() : 0.f;
+}
+
+float UActorInteractableComponentMash::GetLastKeyPressTime() const
+{
+	return KeyPressCount > 0 ? KeyPressTimes[(KeyPressHead + KeyPressHistorySize - 1) % KeyPressHistorySize] : 0.f;
+}
+
+float UActorInteractableComponentMash::GetMashRate() const
+{
+	if (KeyPressCount < 2)
+	{
+		return 0.f;
 	}
+
+	const float oldestPressTime = KeyPressTimes[(KeyPressHead + KeyPressHistorySize - KeyPressCount) % KeyPressHistorySize];
+	const float timeSpan = GetLastKeyPressTime() - oldestPressTime;
+
+	return timeSpan > UE_KINDA_SMALL_NUMBER ? (KeyPressCount - 1) / timeSpan : 0.f;
 }
 
 void UActorInteractableComponentMash::InteractionStopped_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
@@ -141,7 +260,7 @@ void UActorInteractableComponentMash::InteractionCompleted_Implementation(const
 	}
 	else
 	{
-		OnInteractionFailed.Broadcast();
+		NotifyInteractionFailed();
 	}
 
 	CleanupComponent();
@@ -14,12 +14,18 @@
 
 UActorInteractableComponentPress::UActorInteractableComponentPress()
 {
-	bInteractionHighlight = true;
 	DefaultInteractableState = EInteractableStateV2::EIS_Awake;
-	InteractionPeriod = -1.f;
 	InteractableName = NSLOCTEXT("InteractableComponentPress", "Press", "Press");
 }
 
+void UActorInteractableComponentPress::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
+{
+	Super::InitializeArchetypeDefaults(Settings);
+
+	Settings.bInteractionHighlight = true;
+	Settings.InteractionPeriod = -1.f;
+}
+
 void UActorInteractableComponentPress::BeginPlay()
 {
 	Super::BeginPlay();
@@ -35,22 +41,15 @@ void UActorInteractableComponentPress::InteractionStarted_Implementation(const f
 	
 	if (Execute_CanInteract(this))
 	{
-		if (LifecycleMode == EInteractableLifecycle::EIL_Cycled)
+		if (GetArchetypeSettings().LifecycleMode == EInteractableLifecycle::EIL_Cycled)
 		{
 			if (Execute_TriggerCooldown(this)) return;
 		}
 		
-		OnInteractionCompleted.Broadcast(TimeStarted, CausingInteractor);
+		NotifyInteractionCompleted(TimeStarted, CausingInteractor);
 	}
 }
 
-void UActorInteractableComponentPress::SetDefaults_Implementation()
-{
-	Super::SetDefaults_Implementation();
-
-	InteractionPeriod = -1.f;
-}
-
 #if WITH_EDITOR
 
 void UActorInteractableComponentPress::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
@@ -74,11 +73,11 @@ void UActorInteractableComponentPress::PostEditChangeChainProperty(FPropertyChan
 		}
 	}
 	
-	if (PropertyName == TEXT("InteractionPeriod") && !(FMath::IsNearlyEqual(InteractionPeriod, -1.f)))
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(FInteractableArchetypeSettings, InteractionPeriod) && ArchetypeOverride && !(FMath::IsNearlyEqual(ArchetypeOverride->Settings.InteractionPeriod, -1.f)))
 	{
-		InteractionPeriod = -1.f;
+		ArchetypeOverride->Settings.InteractionPeriod = -1.f;
 		
-		if (DebugSettings.EditorDebugMode)
+		if (ArchetypeOverride->Settings.DebugSettings.EditorDebugMode)
 		{
 			const FText ErrorMessage = FText::FromString
 			(
@@ -111,7 +110,7 @@ EDataValidationResult UActorInteractableComponentPress::IsDataValid(FDataValidat
 		}
 	}
 
-	if (!FMath::IsNearlyEqual(InteractionPeriod, -1.f))
+	if (!FMath::IsNearlyEqual(GetArchetypeSettings().InteractionPeriod, -1.f))
 	{
 		const FText ErrorMessage = FText::FromString
 		(
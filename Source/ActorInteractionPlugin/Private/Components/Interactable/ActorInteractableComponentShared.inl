@@ -0,0 +1,3038 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+/**
+ * Definitions shared by `UActorInteractableComponentBase` and `UActorInteractableComponentWidgetless`.
+ * Each of them includes this file once, with `MOUNTEA_INTERACTABLE_CLASS` set to its own class
+ * and `MOUNTEA_INTERACTABLE_WITH_WIDGET` set to 1 when it is Widget Component.
+ */
+
+#ifndef MOUNTEA_INTERACTABLE_CLASS
+#error "MOUNTEA_INTERACTABLE_CLASS must be defined before including ActorInteractableComponentShared.inl"
+#endif
+
+#include "Helpers/ActorInteractionPluginLog.h"
+
+#if WITH_EDITOR
+
+#include "EditorHelper.h"
+#include "Misc/DataValidation.h"
+
+#endif
+
+#include "CommonInputSubsystem.h"
+#include "TimerManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/StringBuilder.h"
+#include "Engine/Level.h"
+
+#include "Components/Interactable/ActorInteractablePromptComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/InputDeviceSubsystem.h"
+
+#include "Helpers/ActorInteractionFunctionLibrary.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+#include "Helpers/MounteaInteractionSystemBFL.h"
+#include "Helpers/MounteaInteractionStats.h"
+#include "Helpers/MounteaInteractionHandleSubsystem.h"
+#include "Helpers/MounteaInteractableInitializationSubsystem.h"
+#include "Helpers/MounteaInteractionSnapshot.h"
+
+#include "Interfaces/ActorInteractionWidget.h"
+#include "Interfaces/ActorInteractorInterface.h"
+
+
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+#define LOCTEXT_NAMESPACE "InteractableComponentBase"
+
+MOUNTEA_INTERACTABLE_CLASS::MOUNTEA_INTERACTABLE_CLASS() :
+		DefaultInteractableState(EInteractableStateV2::EIS_Awake),
+		SetupType(ESetupType::EST_Quick),
+		InteractionWeight(1),
+		InteractableName(LOCTEXT("InteractableComponentBase", "Base")),
+		InteractableState(EInteractableStateV2::EIS_Awake),
+		RemainingLifecycleCount(-1),
+		CachedInteractionWeight(InteractionWeight),
+		bInteractableInitialized(false)
+{
+	bAutoActivate = true;
+	
+	SetIsReplicatedByDefault(true);
+	SetActiveFlag(true);
+
+	// Archetype Override is replicated as registered SubObject
+	bReplicateUsingRegisteredSubObjectList = true;
+
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	bLagCompensated = true;
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	Space = EWidgetSpace::Screen;
+	DrawSize = FIntPoint(64, 64);
+	bDrawAtDesiredSize = false;
+#endif
+
+	UActorComponent::SetActive(true);
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	SetHiddenInGame(true);
+
+#if WITH_EDITORONLY_DATA
+	bVisualizeComponent = true;
+
+	// Only Widget based Interactables were saved before Archetypes
+	bInteractionHighlight_DEPRECATED = true;
+	bCanPersist_DEPRECATED = false;
+#endif
+#endif
+
+#if !UE_GAME
+#if WITH_EDITOR || WITH_EDITORONLY_DATA
+	if (GIsEditor && !GIsPlayInEditorWorld)
+	{
+		RequestEditorDefaults.AddUObject(this, &ThisClass::ResetDefaults);
+	}
+	if (GIsEditor && !GIsPlayInEditorWorld && !bInteractableInitialized)
+	{
+		SetDefaultValues();
+	}
+#endif
+#endif
+
+	bInteractableInitialized = true;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::Activate(bool bReset)
+{
+	const bool bWasActive = IsActive();
+	
+	Super::Activate(bReset);
+
+	// Replaces binding to OnComponentActivated
+	if (HasBegunPlay() && IsActive() && (bReset || !bWasActive))
+	{
+		InteractableComponentActivated(this, bReset);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::BeginPlay()
+{
+	Super::BeginPlay();
+
+	bCosmeticsEnabled = UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld());
+
+	RegisterInteractionHandle();
+
+	bScriptTriggerQueries =
+		GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IActorInteractableInterface, CanInteract)) ||
+		GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IActorInteractableInterface, CanBeTriggered));
+	RefreshTriggerFlags();
+
+	// Only owned Override replicates its Settings, shared Archetypes are referenced by path
+	if (ArchetypeOverride && ArchetypeOverride->GetOuter() == this && GetOwner() && GetOwner()->HasAuthority())
+	{
+		AddReplicatedSubObject(ArchetypeOverride);
+	}
+	
+	RemainingLifecycleCount = GetArchetypeSettings().LifecycleCount;
+
+	UMounteaInteractableInitializationSubsystem::RequestInitialization(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InitializeInteractable()
+{
+	if (bInteractableSetupDone) return;
+
+	bInteractableSetupDone = true;
+
+	// Bind Changing Input Devices
+	{
+		if (AreCosmeticsEnabled())
+		{
+			if (const auto localPlayer = UMounteaInteractionSystemBFL::FindLocalPlayer(GetOwner()))
+			{
+				if (UCommonInputSubsystem* commonInputSubsystem = UCommonInputSubsystem::Get(localPlayer))
+				{
+					commonInputSubsystem->OnInputMethodChangedNative.AddUObject(this, &ThisClass::OnInputModeChanged);
+				}
+			}
+		}
+	}
+
+#if !MOUNTEA_INTERACTABLE_WITH_WIDGET
+	if (PromptComponent == nullptr && AreCosmeticsEnabled())
+	{
+		SetPromptComponent(FindPromptComponent());
+	}
+#endif
+
+	// State set while setup was queued, e.g. by gameplay or restored Snapshot, is kept
+	if (!bStateChangedBeforeSetup)
+	{
+		Execute_SetState(this, DefaultInteractableState);
+	}
+
+	if (bAutoActivate)
+	{
+		AutoSetup();
+	}
+
+	StartRewindSampling();
+
+	RefreshTriggerFlags();
+
+#if WITH_EDITOR
+	
+	DrawDebug();
+
+#endif
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UMounteaInteractableInitializationSubsystem::CancelInitialization(this);
+	
+	StopRewindSampling();
+	ReleaseInteractionHandle();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RegisterInteractionHandle()
+{
+	UMounteaInteractionHandleSubsystem* handleSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+	if (!handleSubsystem || !GetOwner()) return;
+
+	if (GetOwner()->HasAuthority())
+	{
+		InteractionHandle = handleSubsystem->RegisterObject(this);
+	}
+	else
+	{
+		handleSubsystem->BindHandle(InteractionHandle, this);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ReleaseInteractionHandle()
+{
+	if (UMounteaInteractionHandleSubsystem* handleSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr)
+	{
+		handleSubsystem->ReleaseHandle(InteractionHandle);
+	}
+
+	InteractionHandle = FMounteaInteractionHandle();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnRep_InteractionHandle()
+{
+	RegisterInteractionHandle();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnComponentCreated()
+{
+	Super::OnComponentCreated();
+}
+
+#pragma region InteractionImplementations
+
+bool MOUNTEA_INTERACTABLE_CLASS::DoesHaveInteractor_Implementation() const
+{
+	return Interactor.GetObject() != nullptr;
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::DoesAutoSetup_Implementation() const
+{ return SetupType != ESetupType::EST_None; }
+
+void MOUNTEA_INTERACTABLE_CLASS::ToggleAutoSetup_Implementation(const ESetupType& NewValue)
+{
+	SetupType = NewValue;
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::ActivateInteractable_Implementation(FString& ErrorMessage)
+{
+	const EInteractableStateV2 CachedState = InteractableState;
+
+	Execute_SetState(this, EInteractableStateV2::EIS_Active);
+
+	switch (CachedState)
+	{
+		case EInteractableStateV2::EIS_Active:
+			ErrorMessage.Append(TEXT("Interactable Component is already Active"));
+			break;
+		case EInteractableStateV2::EIS_Awake:
+			ErrorMessage.Append(TEXT("Interactable Component has been Activated"));
+			return true;
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Completed:
+		case EInteractableStateV2::EIS_Disabled:
+			ErrorMessage.Append(TEXT("Interactable Component cannot be Activated"));
+			break;
+		case EInteractableStateV2::Default: 
+		default:
+			ErrorMessage.Append(TEXT("Interactable Component cannot proces activation request, invalid state"));
+			break;
+	}
+	
+	return false;
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::WakeUpInteractable_Implementation(FString& ErrorMessage)
+{
+	const EInteractableStateV2 CachedState = InteractableState;
+
+	Execute_SetState(this, EInteractableStateV2::EIS_Awake);
+
+	switch (CachedState)
+	{
+		case EInteractableStateV2::EIS_Awake:
+			ErrorMessage.Append(TEXT("Interactable Component is already Awake"));
+			break;
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Disabled:
+			ErrorMessage.Append(TEXT("Interactable Component has been Awaken"));
+			return true;
+		case EInteractableStateV2::EIS_Completed:
+			ErrorMessage.Append(TEXT("Interactable Component cannot be Awaken"));
+			break;
+		case EInteractableStateV2::Default: 
+		default:
+			ErrorMessage.Append(TEXT("Interactable Component cannot proces activation request, invalid state"));
+			break;
+	}
+	
+	return false;
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::CompleteInteractable_Implementation(FString& ErrorMessage)
+{
+	const EInteractableStateV2 CachedState = InteractableState;
+
+	Execute_SetState(this, EInteractableStateV2::EIS_Completed);
+
+	switch (CachedState)
+	{
+		case EInteractableStateV2::EIS_Active:
+			ErrorMessage.Append(TEXT("Interactable Component is Completed"));
+			return true;
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::EIS_Awake:
+		case EInteractableStateV2::EIS_Disabled:
+		case EInteractableStateV2::EIS_Cooldown:
+			ErrorMessage.Append(TEXT("Interactable Component cannot be Completed"));
+			break;
+		case EInteractableStateV2::EIS_Completed:
+			ErrorMessage.Append(TEXT("Interactable Component is already Completed"));
+			break;
+		case EInteractableStateV2::Default: 
+		default:
+			ErrorMessage.Append(TEXT("Interactable Component cannot proces activation request, invalid state"));
+			break;
+	}
+	
+	return false;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::DeactivateInteractable_Implementation()
+{
+	Execute_SetState(this, EInteractableStateV2::EIS_Disabled);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::PauseInteraction_Implementation(const float ExpirationTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (!GetWorld()) return;
+	
+	Execute_SetState(this, EInteractableStateV2::EIS_Paused);
+
+	const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+	const bool bIsUnlimited = FMath::IsWithinInclusive(archetypeSettings.InteractionProgressExpiration, -1.f, 0.f) || FMath::IsNearlyZero(archetypeSettings.InteractionProgressExpiration, 0.001f);
+
+	const float expirationTime = GetWorld()->GetTimeSeconds();
+	if (archetypeSettings.bCanPersist)
+	{
+		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
+		
+		FTimerDelegate TimerDelegate_ProgressExpiration;
+		
+		TimerDelegate_ProgressExpiration.BindUFunction(this, "OnInteractionProgressExpired", expirationTime, CausingInteractor);
+
+		const float ClampedExpiration = FMath::Max(archetypeSettings.InteractionProgressExpiration, 0.01f);
+		
+		GetWorld()->GetTimerManager().SetTimer(Timer_ProgressExpiration, TimerDelegate_ProgressExpiration, ClampedExpiration, false);
+		GetWorld()->GetTimerManager().PauseTimer(Timer_Interaction);
+	}
+	else
+	{
+		OnInteractionProgressExpired(expirationTime, CausingInteractor);
+	}
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::CanInteract_Implementation() const
+{
+	CheckTriggerFlags();
+	return EnumHasAnyFlags(TriggerFlags, EInteractableTriggerFlags::EITF_CanInteract);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::CanBeTriggered_Implementation() const
+{
+	CheckTriggerFlags();
+	return EnumHasAnyFlags(TriggerFlags, EInteractableTriggerFlags::EITF_CanBeTriggered);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::CanInteractNative() const
+{
+	if (bScriptTriggerQueries) return Execute_CanInteract(this);
+
+	CheckTriggerFlags();
+	return EnumHasAnyFlags(TriggerFlags, EInteractableTriggerFlags::EITF_CanInteract);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::CanBeTriggeredNative() const
+{
+	if (bScriptTriggerQueries) return Execute_CanBeTriggered(this);
+
+	CheckTriggerFlags();
+	return EnumHasAnyFlags(TriggerFlags, EInteractableTriggerFlags::EITF_CanBeTriggered);
+}
+
+EInteractableTriggerFlags MOUNTEA_INTERACTABLE_CLASS::ComputeTriggerFlags() const
+{
+	if (!GetWorld() || !bInteractableSetupDone) return EInteractableTriggerFlags::EITF_None;
+	
+	switch (InteractableState)
+	{
+		case EInteractableStateV2::EIS_Awake:
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Paused:
+			{
+				EInteractableTriggerFlags triggerFlags = EInteractableTriggerFlags::EITF_None;
+				if (Interactor.GetInterface() != nullptr)
+					triggerFlags |= EInteractableTriggerFlags::EITF_CanInteract;
+				if (Interactor.GetObject() == nullptr)
+					triggerFlags |= EInteractableTriggerFlags::EITF_CanBeTriggered;
+				return triggerFlags;
+			}
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Disabled:
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Completed:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::Default: 
+		default: break;
+	}
+	
+	return EInteractableTriggerFlags::EITF_None;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RefreshTriggerFlags()
+{
+	TriggerFlags = ComputeTriggerFlags();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::CheckTriggerFlags() const
+{
+#if DO_CHECK && !UE_BUILD_SHIPPING
+	ensureMsgf(!HasBegunPlay() || TriggerFlags == ComputeTriggerFlags(), TEXT("[CheckTriggerFlags] Cached Trigger Flags of %s are stale, RefreshTriggerFlags is missing where their values change!"), *GetName());
+#endif
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::IsInteracting_Implementation() const
+{
+	// Clients run no Interaction Timer
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		return PresentationState.HasFlags(EInteractablePresentationFlags::EIPF_InteractionActive);
+	}
+
+	if (GetWorld())
+	{
+		return GetWorld()->GetTimerManager().IsTimerActive(Timer_Interaction);
+	}
+
+	LOG_ERROR(TEXT("[IsInteracting] Cannot find World!"))
+	return false;
+}
+
+EInteractableStateV2 MOUNTEA_INTERACTABLE_CLASS::GetDefaultState_Implementation() const
+{ return DefaultInteractableState; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetDefaultState_Implementation(const EInteractableStateV2 NewState)
+{
+	if
+	(
+		DefaultInteractableState == EInteractableStateV2::EIS_Active ||
+		DefaultInteractableState == EInteractableStateV2::EIS_Completed ||
+		DefaultInteractableState == EInteractableStateV2::EIS_Cooldown
+	)
+	{
+		LOG_ERROR(TEXT("[SetDefaultState] Tried to set invalid Default State!"))
+		return;
+	}
+	DefaultInteractableState = NewState;
+}
+
+EInteractableStateV2 MOUNTEA_INTERACTABLE_CLASS::GetState_Implementation() const
+{ return InteractableState; }
+
+void MOUNTEA_INTERACTABLE_CLASS::CleanupComponent()
+{
+	Execute_StopHighlight(this);
+	NotifyInteractableStateChanged(InteractableState);
+	ClearInteractionTimers();
+	NotifyInteractorLost(Interactor);
+
+	Execute_RemoveHighlightableComponents(this, HighlightableComponents);
+	Execute_RemoveCollisionComponents(this, CollisionComponents);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ClearInteractionTimers()
+{
+	if (!GetWorld()) return;
+
+	// Collision flush is armed for next tick, apply pending shapes now instead of losing them
+	if (PendingCollisionShapes.Num() > 0)
+	{
+		FlushCollisionShapes();
+	}
+
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetState_Implementation(const EInteractableStateV2 NewState)
+{
+	MOUNTEA_INTERACTION_SCOPE(SetState, STAT_MounteaInteraction_InteractableSetState);
+
+	if (!GetOwner())
+	{
+		LOG_ERROR(TEXT("[SetState] No owner!"))
+		return;
+	}
+
+	if (GetOwner()->HasAuthority())
+	{
+		const EInteractableStateV2 previousState = InteractableState;
+
+		ApplyStateTransitionEffects(NewState, GetStateTransitionEffects(previousState, NewState));
+
+		if (InteractableState != previousState)
+		{
+			INC_DWORD_STAT(STAT_MounteaInteraction_StateTransitions);
+
+			bStateChangedBeforeSetup |= !bInteractableSetupDone && HasBegunPlay();
+		}
+	
+		Execute_ProcessDependencies(this);
+	}
+	else
+	{
+		SetState_Server(NewState);
+	}
+}
+
+EInteractableStateEffect MOUNTEA_INTERACTABLE_CLASS::GetStateTransitionEffects(const EInteractableStateV2 FromState, const EInteractableStateV2 ToState) const
+{
+	return MounteaInteractionStateMachine::InteractableStateTable.GetEffects(FromState, ToState);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ApplyStateTransitionEffects(const EInteractableStateV2 NewState, const EInteractableStateEffect Effects)
+{
+	if (Effects == EInteractableStateEffect::ESE_None) return;
+	
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_CancelInteraction))
+	{
+		NotifyInteractionCanceled();
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_Allowed))
+	{
+		InteractableState = NewState;
+		RefreshTriggerFlags();
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_StopHighlight))
+	{
+		Execute_StopHighlight(this);
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_BroadcastState))
+	{
+		NotifyInteractableStateChanged(InteractableState);
+	}
+
+	if (GetWorld())
+	{
+		if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_ClearTimers))
+		{
+			ClearInteractionTimers();
+		}
+		else if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_ClearCooldown))
+		{
+			GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
+		}
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_LoseInteractor))
+	{
+		NotifyInteractorLost(Interactor);
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_UnbindCollision))
+	{
+		for (const auto& Itr : CollisionComponents)
+		{
+			Execute_UnbindCollisionShape(this, Itr);
+		}
+	}
+	else if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_BindCollision))
+	{
+		for (const auto& Itr : CollisionComponents)
+		{
+			Execute_BindCollisionShape(this, Itr);
+		}
+	}
+
+	if (EnumHasAnyFlags(Effects, EInteractableStateEffect::ESE_Cleanup))
+	{
+		CleanupComponent();
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::StartHighlight_Implementation()
+{
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		SetPresentationFlags(EInteractablePresentationFlags::EIPF_Highlighted, true);
+
+		if (!AreCosmeticsEnabled()) return;
+	}
+
+	ProcessStartHighlight();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::StopHighlight_Implementation()
+{
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		SetPresentationFlags(EInteractablePresentationFlags::EIPF_Highlighted, false);
+
+		if (!AreCosmeticsEnabled()) return;
+	}
+
+	ProcessStopHighlight();
+}
+
+TArray<TSoftClassPtr<UObject>> MOUNTEA_INTERACTABLE_CLASS::GetIgnoredClasses_Implementation() const
+{ return GetArchetypeSettings().IgnoredClasses; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetIgnoredClasses_Implementation(const TArray<TSoftClassPtr<UObject>>& NewIgnoredClasses)
+{
+	if (GetArchetypeSettings().IgnoredClasses == NewIgnoredClasses) return;
+
+	EditArchetypeSettings().IgnoredClasses = NewIgnoredClasses;
+	ArchetypeOverride->MarkIgnoredClassesDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddIgnoredClass_Implementation(const TSoftClassPtr<UObject>& AddIgnoredClass)
+{
+	if (AddIgnoredClass == nullptr) return;
+
+	if (GetArchetypeSettings().IgnoredClasses.Contains(AddIgnoredClass)) return;
+
+	EditArchetypeSettings().IgnoredClasses.Add(AddIgnoredClass);
+	ArchetypeOverride->MarkIgnoredClassesDirty();
+
+	NotifyIgnoredInteractorClassAdded(AddIgnoredClass);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddIgnoredClasses_Implementation(const TArray<TSoftClassPtr<UObject>>& AddIgnoredClasses)
+{
+	for (const auto& Itr : AddIgnoredClasses)
+	{
+		Execute_AddIgnoredClass(this, Itr);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveIgnoredClass_Implementation(const TSoftClassPtr<UObject>& RemoveIgnoredClass)
+{
+	if (RemoveIgnoredClass == nullptr) return;
+
+	if (!GetArchetypeSettings().IgnoredClasses.Contains(RemoveIgnoredClass)) return;
+
+	EditArchetypeSettings().IgnoredClasses.Remove(RemoveIgnoredClass);
+	ArchetypeOverride->MarkIgnoredClassesDirty();
+
+	NotifyIgnoredInteractorClassRemoved(RemoveIgnoredClass);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveIgnoredClasses_Implementation(const TArray<TSoftClassPtr<UObject>>& RemoveIgnoredClasses)
+{
+	for (const auto& Itr : RemoveIgnoredClasses)
+	{
+		Execute_RemoveIgnoredClass(this, Itr);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddInteractionDependency_Implementation(const TScriptInterface<IActorInteractableInterface>& InteractionDependency)
+{
+	if (InteractionDependency.GetObject() == nullptr) return;
+	if (InteractionDependencies.Contains(InteractionDependency)) return;
+
+	NotifyInteractableDependencyChanged(InteractionDependency);
+	
+	InteractionDependencies.Add(InteractionDependency);
+
+	InteractionDependency->NotifyInteractableDependencyStarted(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveInteractionDependency_Implementation(const TScriptInterface<IActorInteractableInterface>& InteractionDependency)
+{
+	if (InteractionDependency.GetObject() == nullptr) return;
+	if (!InteractionDependencies.Contains(InteractionDependency)) return;
+
+	NotifyInteractableDependencyChanged(InteractionDependency);
+
+	InteractionDependencies.Remove(InteractionDependency);
+
+	InteractionDependency->NotifyInteractableDependencyStopped(this);
+}
+
+TArray<TScriptInterface<IActorInteractableInterface>> MOUNTEA_INTERACTABLE_CLASS::GetInteractionDependencies_Implementation() const
+{ return InteractionDependencies; }
+
+void MOUNTEA_INTERACTABLE_CLASS::ProcessDependencies_Implementation()
+{
+	MOUNTEA_INTERACTION_SCOPE(ProcessDependencies, STAT_MounteaInteraction_ProcessDependencies);
+
+	if (InteractionDependencies.Num() == 0) return;
+
+	auto Dependencies = InteractionDependencies;
+	for (const auto& Itr : Dependencies)
+	{
+		switch (InteractableState)
+		{
+			case EInteractableStateV2::EIS_Active:
+			case EInteractableStateV2::EIS_Suppressed:
+				Itr->NotifyInteractableDependencyStarted(this);
+				switch (Itr->Execute_GetState(Itr.GetObject()))
+				{
+					case EInteractableStateV2::EIS_Active:
+					case EInteractableStateV2::EIS_Awake:
+					case EInteractableStateV2::EIS_Asleep:
+						Itr->Execute_SetState(this, EInteractableStateV2::EIS_Suppressed);
+						break;
+					case EInteractableStateV2::EIS_Cooldown:
+						
+						Itr->Execute_SetState(this, EInteractableStateV2::EIS_Suppressed);
+						
+						break;
+					case EInteractableStateV2::EIS_Completed: break;
+					case EInteractableStateV2::EIS_Disabled: break;
+					case EInteractableStateV2::EIS_Suppressed: break;
+					case EInteractableStateV2::Default: break;
+					default: break;
+				}
+				break;
+			case EInteractableStateV2::EIS_Cooldown:
+			case EInteractableStateV2::EIS_Awake:
+			case EInteractableStateV2::EIS_Asleep:
+				Itr->NotifyInteractableDependencyStarted(this);
+				switch (Itr->Execute_GetState(Itr.GetObject()))
+				{
+					
+					case EInteractableStateV2::EIS_Awake:
+					case EInteractableStateV2::EIS_Asleep:
+					case EInteractableStateV2::EIS_Suppressed: 
+						Itr->Execute_SetState(this, Itr->Execute_GetDefaultState(Itr.GetObject()));
+						break;
+					case EInteractableStateV2::EIS_Cooldown: break;
+					case EInteractableStateV2::EIS_Completed: break;
+					case EInteractableStateV2::EIS_Disabled: break;
+					case EInteractableStateV2::EIS_Active:
+					case EInteractableStateV2::Default: break;
+					default: break;
+				}
+				break;
+			case EInteractableStateV2::EIS_Disabled:
+			case EInteractableStateV2::EIS_Completed:
+				Itr->NotifyInteractableDependencyStopped(this);
+				Itr->Execute_SetState(this, Itr->Execute_GetDefaultState(Itr.GetObject()));
+				Execute_RemoveInteractionDependency(this, Itr);
+				break;
+			case EInteractableStateV2::Default:
+			default:
+				break;
+		}
+	}
+}
+
+TScriptInterface<IActorInteractorInterface> MOUNTEA_INTERACTABLE_CLASS::GetInteractor_Implementation() const
+{ return Interactor; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractor_Implementation(const TScriptInterface<IActorInteractorInterface>& NewInteractor)
+{
+	const TScriptInterface<IActorInteractorInterface> OldInteractor = Interactor;
+
+	Interactor = NewInteractor;
+	RefreshTriggerFlags();
+	
+	if (NewInteractor.GetInterface() != nullptr)
+	{
+		//NewInteractor->GetOnInteractableSelectedHandle().AddUniqueDynamic(this, &ThisClass::InteractableSelected);
+		//NewInteractor->GetOnInteractableFoundHandle().Broadcast(this);
+
+		NewInteractor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &ThisClass::InteractorActionConsumed);
+
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			GetOwner()->SetOwner(Interactor->Execute_GetOwningActor(Interactor.GetObject()));
+		}
+	}
+	else
+	{
+		if (OldInteractor.GetInterface() != nullptr)
+		{
+			//OldInteractor->GetOnInteractableSelectedHandle().RemoveDynamic(this, &ThisClass::InteractableSelected);
+			OldInteractor->GetInputActionConsumedHandle().RemoveDynamic(this, &ThisClass::InteractorActionConsumed);
+		}
+
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			GetOwner()->SetOwner(nullptr);
+		}
+
+		Execute_StopHighlight(this);
+	}
+
+	//Interactor = NewInteractor;
+	NotifyInteractorChanged(Interactor);
+}
+
+float MOUNTEA_INTERACTABLE_CLASS::GetInteractionProgress_Implementation() const
+{
+	if (!GetWorld()) return -1;
+
+	// Only running or paused Interaction has progress
+	if (InteractableState != EInteractableStateV2::EIS_Active && InteractableState != EInteractableStateV2::EIS_Paused)
+	{
+		return 0.f;
+	}
+
+	return PresentationState.GetProgress(GetServerWorldTime());
+}
+
+float MOUNTEA_INTERACTABLE_CLASS::GetInteractionPeriod_Implementation() const
+{ return GetArchetypeSettings().InteractionPeriod; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractionPeriod_Implementation(const float NewPeriod)
+{
+	float TempPeriod = NewPeriod;
+	if (TempPeriod > -1.f && TempPeriod < 0.01f)
+	{
+		TempPeriod = 0.01f;
+	}
+	if (FMath::IsNearlyZero(TempPeriod, 0.0001f))
+	{
+		TempPeriod = 0.01f;
+	}
+
+	TempPeriod = FMath::Max(-1.f, TempPeriod);
+
+	if (FMath::IsNearlyEqual(GetArchetypeSettings().InteractionPeriod, TempPeriod)) return;
+	
+	EditArchetypeSettings().InteractionPeriod = TempPeriod;
+}
+
+int32 MOUNTEA_INTERACTABLE_CLASS::GetInteractableWeight_Implementation() const
+{ return InteractionWeight; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractableWeight_Implementation(const int32 NewWeight)
+{
+	InteractionWeight = NewWeight;
+
+	NotifyInteractableWeightChanged(InteractionWeight);
+}
+
+AActor* MOUNTEA_INTERACTABLE_CLASS::GetInteractableOwner_Implementation() const
+{ return GetOwner(); }
+
+ECollisionChannel MOUNTEA_INTERACTABLE_CLASS::GetCollisionChannel_Implementation() const
+{ return CollisionChannel; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetCollisionChannel_Implementation(const TEnumAsByte<ECollisionChannel>& NewChannel)
+{
+	CollisionChannel = NewChannel;
+
+	NotifyInteractableCollisionChannelChanged(CollisionChannel);
+}
+
+TArray<UPrimitiveComponent*> MOUNTEA_INTERACTABLE_CLASS::GetCollisionComponents_Implementation() const
+{	return CollisionComponents;}
+
+EInteractableLifecycle MOUNTEA_INTERACTABLE_CLASS::GetLifecycleMode_Implementation() const
+{	return GetArchetypeSettings().LifecycleMode;}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetLifecycleMode_Implementation(const EInteractableLifecycle& NewMode)
+{
+	if (GetArchetypeSettings().LifecycleMode != NewMode)
+	{
+		EditArchetypeSettings().LifecycleMode = NewMode;
+	}
+
+	NotifyLifecycleModeChanged(NewMode);
+}
+
+int32 MOUNTEA_INTERACTABLE_CLASS::GetLifecycleCount_Implementation() const
+{	return GetArchetypeSettings().LifecycleCount;}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetLifecycleCount_Implementation(const int32 NewLifecycleCount)
+{
+	switch (GetArchetypeSettings().LifecycleMode)
+	{
+		case EInteractableLifecycle::EIL_Cycled:
+			{
+				int32 clampedLifecycleCount = NewLifecycleCount;
+				if (NewLifecycleCount < -1)
+				{
+					clampedLifecycleCount = -1;
+				}
+				else if (NewLifecycleCount < 2)
+				{
+					clampedLifecycleCount = 2;
+				}
+				else if (NewLifecycleCount == 2)
+				{
+					break;
+				}
+
+				if (GetArchetypeSettings().LifecycleCount != clampedLifecycleCount)
+				{
+					EditArchetypeSettings().LifecycleCount = clampedLifecycleCount;
+				}
+				NotifyLifecycleCountChanged(clampedLifecycleCount);
+			}
+			break;
+		case EInteractableLifecycle::EIL_OnlyOnce:
+		case EInteractableLifecycle::Default:
+		default: break;
+	}
+}
+
+int32 MOUNTEA_INTERACTABLE_CLASS::GetRemainingLifecycleCount_Implementation() const
+{ return RemainingLifecycleCount; }
+
+void MOUNTEA_INTERACTABLE_CLASS::StartRewindSampling()
+{
+	const AActor* owningActor = GetOwner();
+	if (!bLagCompensated || !owningActor || !owningActor->HasAuthority() || !GetWorld() || GetWorld()->GetNetMode() == NM_Standalone)
+		return;
+
+	// Static Owners never need rewinding
+	if (!owningActor->GetRootComponent() || owningActor->GetRootComponent()->Mobility != EComponentMobility::Movable)
+		return;
+
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const float maxRewindTime = interactionSettings ? interactionSettings->GetLagCompensationMaxRewindTime() : 0.f;
+	if (maxRewindTime <= 0.f)
+		return;
+
+	// Sampling at net rate is enough, Clients never see more frequent updates
+	const int32 maxSamples = FMath::Max(2, interactionSettings->GetLagCompensationMaxSamples());
+	const float samplingInterval = FMath::Max(maxRewindTime / (maxSamples - 1), 1.f / FMath::Max(1.f, owningActor->NetUpdateFrequency));
+	// One extra sample marks when resting Owner started moving again
+	const int32 samplesCount = FMath::Min(maxSamples, FMath::CeilToInt32(maxRewindTime / samplingInterval) + 1) + 1;
+
+	StopRewindSampling();
+
+	RewindBuffer.Initialize(samplesCount);
+	RewindSamplingInterval = samplingInterval;
+	INC_MEMORY_STAT_BY(STAT_MounteaInteraction_RewindMemory, RewindBuffer.GetAllocatedSize());
+
+	SampleRewindTransform();
+
+	// Sampled only when Owner moves, resting Owners keep their newest sample
+	RewindSampledComponent = owningActor->GetRootComponent();
+	RewindTransformUpdatedHandle = owningActor->GetRootComponent()->TransformUpdated.AddUObject(this, &ThisClass::OnRewindTransformUpdated);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::StopRewindSampling()
+{
+	if (USceneComponent* sampledComponent = RewindSampledComponent.Get())
+	{
+		sampledComponent->TransformUpdated.Remove(RewindTransformUpdatedHandle);
+	}
+	RewindSampledComponent.Reset();
+	RewindTransformUpdatedHandle.Reset();
+
+	if (RewindBuffer.IsInitialized())
+	{
+		DEC_MEMORY_STAT_BY(STAT_MounteaInteraction_RewindMemory, RewindBuffer.GetAllocatedSize());
+		RewindBuffer.Release();
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnRewindTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	SampleRewindTransform();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SampleRewindTransform()
+{
+	if (!GetOwner() || !GetWorld()) return;
+
+	const float sampleTime = GetWorld()->GetTimeSeconds();
+
+	// Owner rested until previous frame, otherwise rewinding would interpolate over the whole rest
+	RewindBuffer.HoldNewestSample(sampleTime - GetWorld()->GetDeltaSeconds());
+	RewindBuffer.AddSample(sampleTime, GetOwner()->GetActorTransform(), RewindSamplingInterval);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::GetRewoundTransform(const float Time, FTransform& OutTransform) const
+{
+	return RewindBuffer.GetTransformAt(Time, OutTransform);
+}
+
+uint64 MOUNTEA_INTERACTABLE_CLASS::GetSnapshotId() const
+{
+	TStringBuilder<256> snapshotPath;
+	if (const AActor* owningActor = GetOwner())
+	{
+		// Level package separates equally named Actors of sublevels and Level Instances, PIE prefix must not change ID between sessions
+		if (const ULevel* owningLevel = owningActor->GetLevel())
+		{
+			snapshotPath << UWorld::RemovePIEPrefix(owningLevel->GetPackage()->GetName()) << TEXT(':');
+		}
+		owningActor->GetFName().AppendString(snapshotPath);
+		snapshotPath << TEXT('.');
+	}
+	GetFName().AppendString(snapshotPath);
+
+	return CityHash64(reinterpret_cast<const char*>(snapshotPath.GetData()), snapshotPath.Len() * sizeof(TCHAR));
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::CaptureSnapshotRecord(FMounteaInteractableSnapshotRecord& OutRecord) const
+{
+	OutRecord.Id											= GetSnapshotId();
+	OutRecord.State										= InteractableState;
+	OutRecord.RemainingLifecycleCount		= RemainingLifecycleCount;
+	OutRecord.InteractionWeight					= InteractionWeight;
+
+	if (!GetWorld()) return;
+
+	const FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	OutRecord.RemainingCooldown = InteractableState == EInteractableStateV2::EIS_Cooldown ? FMath::Max(0.f, timerManager.GetTimerRemaining(Timer_Cooldown)) : 0.f;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RestoreSnapshotRecord(const FMounteaInteractableSnapshotRecord& Record)
+{
+	if (!GetWorld()) return;
+
+	// Deferred setup would replace restored State by Default State
+	UMounteaInteractableInitializationSubsystem::InitializeImmediately(this);
+
+	FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	timerManager.ClearTimer(Timer_Interaction);
+	timerManager.ClearTimer(Timer_ProgressExpiration);
+	timerManager.ClearTimer(Timer_Cooldown);
+
+	const bool bWasInteracting = Record.State == EInteractableStateV2::EIS_Active || Record.State == EInteractableStateV2::EIS_Paused;
+	const EInteractableStateV2 restoredState = bWasInteracting ? EInteractableStateV2::EIS_Awake : Record.State;
+
+	RemainingLifecycleCount		= Record.RemainingLifecycleCount;
+	InteractionWeight					= Record.InteractionWeight;
+
+	// Interaction is not restored, nobody interacts with restored Interactable
+	if (bWasInteracting)
+	{
+		Execute_SetInteractor(this, nullptr);
+		SetPresentationInteractor(nullptr);
+	}
+
+	// Restored State is not a gameplay transition, but Collision and Highlight must still match it
+	EInteractableStateEffect restoreEffects = GetStateTransitionEffects(InteractableState, restoredState) & ~(EInteractableStateEffect::ESE_BroadcastState | EInteractableStateEffect::ESE_CancelInteraction);
+	if (Interactor.GetObject() == nullptr)
+	{
+		EnumRemoveFlags(restoreEffects, EInteractableStateEffect::ESE_LoseInteractor);
+	}
+	ApplyStateTransitionEffects(restoredState, restoreEffects);
+
+	// Saved State always wins, even if the table has no edge to it
+	InteractableState = restoredState;
+
+	if (InteractableState == EInteractableStateV2::EIS_Cooldown)
+	{
+		FTimerDelegate cooldownDelegate;
+		cooldownDelegate.BindUObject(this, &ThisClass::OnCooldownCompletedCallback);
+
+		timerManager.SetTimer(Timer_Cooldown, cooldownDelegate, FMath::Max(Record.RemainingCooldown, 0.01f), false);
+	}
+
+	RefreshTriggerFlags();
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::IsCompatibleWithTag(const FGameplayTag& Tag, const uint64 TagBit) const
+{
+	if (TagBit != 0)
+	{
+		return GetResolvedArchetype()->GetCompatibleTagBits().HasTagBit(TagBit);
+	}
+
+	return GetArchetypeSettings().InteractableCompatibleTags.HasTag(Tag);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::IsInteractorClassIgnored(const UClass* InteractorClass) const
+{
+	return GetResolvedArchetype()->IsInteractorClassIgnored(InteractorClass);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetRemainingLifecycleCount(const int32 NewRemainingLifecycleCount)
+{
+	RemainingLifecycleCount = FMath::Max(-1, NewRemainingLifecycleCount);
+}
+
+float MOUNTEA_INTERACTABLE_CLASS::GetCooldownPeriod_Implementation() const
+{ return GetArchetypeSettings().CooldownPeriod; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetCooldownPeriod_Implementation(const float NewCooldownPeriod)
+{
+	switch (GetArchetypeSettings().LifecycleMode)
+	{
+		case EInteractableLifecycle::EIL_Cycled:
+			{
+				const float clampedCooldownPeriod = FMath::Max(0.1f, NewCooldownPeriod);
+				if (FMath::IsNearlyEqual(GetArchetypeSettings().CooldownPeriod, clampedCooldownPeriod)) break;
+
+				EditArchetypeSettings().CooldownPeriod = clampedCooldownPeriod;
+				OnCooldownPeriodChanged.Broadcast(clampedCooldownPeriod);
+			}
+			break;
+		case EInteractableLifecycle::EIL_OnlyOnce:
+		case EInteractableLifecycle::Default:
+		default: break;
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddCollisionComponent_Implementation(UPrimitiveComponent* CollisionComp)
+{
+	if (CollisionComp == nullptr) return;
+	if (CollisionComponents.Contains(CollisionComp)) return;
+	
+	CollisionComponents.Add(CollisionComp);
+	
+	Execute_BindCollisionShape(this, CollisionComp);
+	
+	NotifyCollisionComponentAdded(CollisionComp);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& NewCollisionComponents)
+{
+	for (UPrimitiveComponent* const Itr : NewCollisionComponents)
+	{
+		Execute_AddCollisionComponent(this, Itr);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveCollisionComponent_Implementation(UPrimitiveComponent* CollisionComp)
+{
+	if (CollisionComp == nullptr) return;
+	if (!CollisionComponents.Contains(CollisionComp)) return;
+	
+	CollisionComponents.Remove(CollisionComp);
+
+	Execute_UnbindCollisionShape(this, CollisionComp);
+	ReleaseCollisionShape(CollisionComp);
+	
+	NotifyCollisionComponentRemoved(CollisionComp);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveCollisionComponents_Implementation(const TArray<UPrimitiveComponent*>& RemoveCollisionComponents)
+{
+	for (UPrimitiveComponent* const Itr : RemoveCollisionComponents)
+	{
+		Execute_RemoveCollisionComponent(this, Itr);
+	}
+}
+
+TArray<UMeshComponent*> MOUNTEA_INTERACTABLE_CLASS::GetHighlightableComponents_Implementation() const
+{	return HighlightableComponents;}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddHighlightableComponent_Implementation(UMeshComponent* MeshComponent)
+{
+	if (MeshComponent == nullptr) return;
+	if (HighlightableComponents.Contains(MeshComponent)) return;
+
+	// Highlight is cosmetic only, dedicated servers keep no Highlightable Components
+	if (!AreCosmeticsEnabled())
+	{
+		LOG_INFO(TEXT("[AddHighlightableComponent] %s ignored on dedicated server, Highlight is cosmetic only"), *MeshComponent->GetName())
+		return;
+	}
+
+	HighlightableComponents.Add(MeshComponent);
+
+	Execute_BindHighlightableMesh(this, MeshComponent);
+
+	NotifyHighlightableComponentAdded(MeshComponent);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddHighlightableComponents_Implementation(const TArray<UMeshComponent*>& AddMeshComponents)
+{
+	for (UMeshComponent* const Itr : HighlightableComponents)
+	{
+		Execute_AddHighlightableComponent(this, Itr);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveHighlightableComponent_Implementation(UMeshComponent* MeshComponent)
+{
+	if (MeshComponent == nullptr) return;
+	if (!HighlightableComponents.Contains(MeshComponent)) return;
+
+	HighlightableComponents.Remove(MeshComponent);
+
+	Execute_UnbindHighlightableMesh(this, MeshComponent);
+
+	NotifyHighlightableComponentRemoved(MeshComponent);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveHighlightableComponents_Implementation(const TArray<UMeshComponent*>& RemoveMeshComponents)
+{
+	for (UMeshComponent* const Itr : RemoveMeshComponents)
+	{
+		Execute_RemoveHighlightableComponent(this, Itr);
+	}
+}
+
+TArray<FName> MOUNTEA_INTERACTABLE_CLASS::GetCollisionOverrides_Implementation() const
+{	return GetArchetypeSettings().CollisionOverrides;}
+
+TArray<FName> MOUNTEA_INTERACTABLE_CLASS::GetHighlightableOverrides_Implementation() const
+{	return GetArchetypeSettings().HighlightableOverrides;}
+
+FDataTableRowHandle MOUNTEA_INTERACTABLE_CLASS::GetInteractableData_Implementation() const
+{ return InteractableData; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractableData_Implementation(FDataTableRowHandle NewData)
+{ InteractableData = NewData; }
+
+FText MOUNTEA_INTERACTABLE_CLASS::GetInteractableName_Implementation() const
+{ return InteractableName; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractableName_Implementation(const FText& NewName)
+{
+	if (NewName.IsEmpty()) return;
+	InteractableName = NewName;
+}
+
+EHighlightType MOUNTEA_INTERACTABLE_CLASS::GetHighlightType_Implementation() const
+{ return GetArchetypeSettings().HighlightType; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetHighlightType_Implementation(const EHighlightType NewHighlightType)
+{
+	if (GetArchetypeSettings().HighlightType != NewHighlightType)
+	{
+		EditArchetypeSettings().HighlightType = NewHighlightType;
+	}
+
+	NotifyHighlightTypeChanged(NewHighlightType);
+}
+
+UMaterialInterface* MOUNTEA_INTERACTABLE_CLASS::GetHighlightMaterial_Implementation() const
+{ return GetArchetypeSettings().HighlightMaterial; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetHighlightMaterial_Implementation(UMaterialInterface* NewHighlightMaterial)
+{
+	if (GetArchetypeSettings().HighlightMaterial != NewHighlightMaterial)
+	{
+		EditArchetypeSettings().HighlightMaterial = NewHighlightMaterial;
+	}
+
+	NotifyHighlightMaterialChanged(NewHighlightMaterial);
+}
+
+ETimingComparison MOUNTEA_INTERACTABLE_CLASS::GetComparisonMethod_Implementation() const
+{ return GetArchetypeSettings().ComparisonMethod; }
+
+void MOUNTEA_INTERACTABLE_CLASS::SetComparisonMethod_Implementation(const ETimingComparison Value)
+{
+	if (GetArchetypeSettings().ComparisonMethod == Value) return;
+	
+	EditArchetypeSettings().ComparisonMethod = Value;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetDefaults_Implementation()
+{
+	if (const auto DefaultTable = UActorInteractionFunctionLibrary::GetInteractableDefaultDataTable())
+	{
+		InteractableData.DataTable = DefaultTable;
+	}
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	if (const auto DefaultWidgetClass = UActorInteractionFunctionLibrary::GetInteractableDefaultWidgetClass())
+	{
+		if (DefaultWidgetClass != nullptr)
+		{
+			SetWidgetClass(DefaultWidgetClass.Get());
+		}
+	}
+#endif
+
+	auto defaultSettings = UActorInteractionFunctionLibrary::GetDefaultInteractableSettings();
+	{
+		InteractableState = defaultSettings.DefaultInteractableState;
+		SetupType			= defaultSettings.DefaultSetupType;
+		CollisionChannel = defaultSettings.DefaultCollisionChannel;
+		InteractionWeight = defaultSettings.DefaultInteractableWeight;
+	}
+	RefreshTriggerFlags();
+
+	// Shared values come from class Archetype, which is built from the same Project Settings
+	ResetArchetypeOverride();
+}
+
+FGameplayTagContainer MOUNTEA_INTERACTABLE_CLASS::GetInteractableCompatibleTags_Implementation() const
+{
+	return GetArchetypeSettings().InteractableCompatibleTags;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
+{
+	if (GetArchetypeSettings().InteractableCompatibleTags == Tags) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags = Tags;
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddInteractableCompatibleTag_Implementation(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid() || GetArchetypeSettings().InteractableCompatibleTags.HasTagExact(Tag)) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags.AddTag(Tag);
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AddInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
+{
+	if (GetArchetypeSettings().InteractableCompatibleTags.HasAllExact(Tags)) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags.AppendTags(Tags);
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveInteractableCompatibleTag_Implementation(const FGameplayTag& Tag)
+{
+	if (!GetArchetypeSettings().InteractableCompatibleTags.HasTagExact(Tag)) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags.RemoveTag(Tag);
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::RemoveInteractableCompatibleTags_Implementation(const FGameplayTagContainer& Tags)
+{
+	if (!GetArchetypeSettings().InteractableCompatibleTags.HasAnyExact(Tags)) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags.RemoveTags(Tags);
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ClearInteractableCompatibleTags_Implementation()
+{
+	if (GetArchetypeSettings().InteractableCompatibleTags.IsEmpty()) return;
+	
+	EditArchetypeSettings().InteractableCompatibleTags.Reset();
+	ArchetypeOverride->MarkCompatibleTagsDirty();
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::HasInteractor_Implementation() const
+{
+	return Interactor.GetObject() != nullptr && Interactor.GetInterface() != nullptr;
+}
+
+AActor* MOUNTEA_INTERACTABLE_CLASS::GetOwningActor_Implementation() const
+{
+	return GetOwner();
+}
+
+FString MOUNTEA_INTERACTABLE_CLASS::ToString_Implementation() const
+{
+	FText interactableNameText = InteractableName;
+	const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+	FText interactableStateText = FText::FromString(UEnum::GetValueAsString(InteractableState));
+	FText lifecycleModeText = FText::FromString(UEnum::GetValueAsString(archetypeSettings.LifecycleMode));
+	FText interactableCompatibleTagsText = FText::FromString(archetypeSettings.InteractableCompatibleTags.ToStringSimple());
+	FText interactionHighlightText = FText::FromString(archetypeSettings.bInteractionHighlight ? TEXT("True") : TEXT("False"));
+	FText highlightTypeText = FText::FromString(UEnum::GetValueAsString(archetypeSettings.HighlightType));
+	FText canPersistText = FText::FromString(archetypeSettings.bCanPersist ? TEXT("True") : TEXT("False"));
+	FText interactionProgressExpirationText = archetypeSettings.bCanPersist ? FText::AsNumber(archetypeSettings.InteractionProgressExpiration) : FText::FromString("N/A");
+	FText interactableDataText = FText::FromString(InteractableData.RowName.ToString());
+	FText lifecycleCountText = (archetypeSettings.LifecycleMode == EInteractableLifecycle::EIL_Cycled) ? FText::AsNumber(archetypeSettings.LifecycleCount) : FText::FromString("N/A");
+	FText remainingLifecycleCountText = (archetypeSettings.LifecycleMode == EInteractableLifecycle::EIL_Cycled) ? FText::AsNumber(RemainingLifecycleCount) : FText::FromString("N/A");
+	FText collisionComponentsCountText = FText::AsNumber(CollisionComponents.Num());
+	FText highlightableComponentsCountText = FText::AsNumber(HighlightableComponents.Num());
+	FText interactionWeightText = FText::AsNumber(InteractionWeight);
+	FText interactorText = Interactor.GetObject() ? FText::FromString(Interactor->Execute_GetOwningActor(Interactor.GetObject()) ? Interactor->Execute_GetOwningActor(Interactor.GetObject())->GetName() : TEXT("invalid")) : FText::FromString("None");
+
+	return FText::Format(
+		NSLOCTEXT("InteractableDebugData", "Format", 
+			"Interactable Name: {0}\n"
+			"Interactable State: {1}\n"
+			"Lifecycle Mode: {2}\n"
+			"Interactable Compatible Tags: {3}\n"
+			"Interaction Highlight: {4}\n"
+			"Highlight Type: {5}\n"
+			"Can Persist: {6}\n"
+			"Interaction Progress Expiration: {7}\n"
+			"Interactable Data: {8}\n"
+			"Lifecycle Count: {9}\n"
+			"Remaining Lifecycle Count: {10}\n"
+			"Collision Components Count: {11}\n"
+			"Highlightable Components Count: {12}\n"
+			"Interaction Weight: {13}\n"
+			"Interactor: {14}"),
+		interactableNameText, interactableStateText, lifecycleModeText, interactableCompatibleTagsText, interactionHighlightText, highlightTypeText,
+		canPersistText, interactionProgressExpirationText, interactableDataText, lifecycleCountText, remainingLifecycleCountText,
+		collisionComponentsCountText, highlightableComponentsCountText, interactionWeightText, interactorText
+	).ToString();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractorFound_Implementation(const TScriptInterface<IActorInteractorInterface>& FoundInteractor)
+{
+	if (FoundInteractor.GetObject() && IsInteractorClassIgnored(FoundInteractor.GetObject()->GetClass()))
+	{
+		LOG_INFO(TEXT("[InteractorFound] %s Interactor is ignored by %s Interactable"), *FoundInteractor.GetObject()->GetName(), *GetName())
+		return;
+	}
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (CanBeTriggeredNative())
+		{
+			Execute_SetInteractor(this, FoundInteractor);
+
+			SetPresentationInteractor(FoundInteractor);
+			ProcessToggleActive(true);
+		
+			Execute_OnInteractorFoundEvent(this, FoundInteractor);
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractorLost_Implementation(const TScriptInterface<IActorInteractorInterface>& LostInteractor)
+{
+	if (LostInteractor.GetInterface() == nullptr) return;
+
+	if (Interactor != LostInteractor)
+		return;	
+	
+	GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
+	GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+	GetWorld()->GetTimerManager().ClearTimer(Timer_Cooldown);
+		
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		ProcessToggleActive(false);
+		SetPresentationInteractor(nullptr);
+	}
+
+	switch (InteractableState)
+	{
+		case EInteractableStateV2::EIS_Cooldown:
+			if (Execute_GetInteractor(this).GetObject() == nullptr)
+			{
+				Execute_SetState(this, DefaultInteractableState);
+			}
+			break;
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::EIS_Suppressed:
+			Execute_SetState(this, DefaultInteractableState);
+			break;
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Awake:
+		case EInteractableStateV2::EIS_Paused:
+			Execute_SetState(this, DefaultInteractableState);
+			break;
+		case EInteractableStateV2::EIS_Completed:
+		case EInteractableStateV2::EIS_Disabled:
+		case EInteractableStateV2::Default:
+		default: break;
+	}
+		
+	if (Interactor.GetInterface() != nullptr)
+	{
+		Interactor->GetOnInteractableSelectedHandle().RemoveDynamic(this, &ThisClass::InteractableSelected);
+		Interactor->GetOnInteractableLostHandle().RemoveDynamic(this, &ThisClass::InteractableLost);
+	}
+		
+	Execute_SetInteractor(this, nullptr);
+	Execute_OnInteractorLostEvent(this, LostInteractor);
+
+	NotifyInteractionCanceled();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	Execute_ToggleWidgetVisibility(this, false);
+	
+	if (GetArchetypeSettings().LifecycleMode == EInteractableLifecycle::EIL_Cycled)
+	{
+		if (Execute_TriggerCooldown(this)) return;
+	}
+	
+	FString ErrorMessage;
+	if( Execute_CompleteInteractable(this, ErrorMessage))
+	{
+		Execute_OnInteractionCompletedEvent(this, TimeCompleted, CausingInteractor);
+	}
+	else LOG_INFO(TEXT("%s"), *ErrorMessage);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionCycleCompleted_Implementation(const float& CompletedTime, const int32 CyclesRemaining, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	Execute_OnInteractionCycleCompletedEvent(this, CompletedTime, CyclesRemaining, CausingInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (Execute_CanInteract(this) && GetOwner() && GetOwner()->HasAuthority())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+		
+		Execute_SetState(this, EInteractableStateV2::EIS_Active);
+		Execute_OnInteractionStartedEvent(this, TimeStarted, CausingInteractor);
+
+		SetPresentationInteractionStarted(CausingInteractor);
+
+		if (AreCosmeticsEnabled())
+		{
+			Interactor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &ThisClass::InteractorActionConsumed);
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionStopped_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (!GetWorld()) return;
+
+	// Only Active interaction can be stopped!
+	switch (InteractableState)
+	{
+		case EInteractableStateV2::EIS_Active:
+			break;
+		case EInteractableStateV2::EIS_Awake:
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Paused:
+		case EInteractableStateV2::EIS_Completed:
+		case EInteractableStateV2::EIS_Disabled:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::Default:
+			return;
+	}
+	
+	const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+	SetPresentationInteractionStopped(archetypeSettings.bCanPersist);
+
+	if (archetypeSettings.bCanPersist)
+	{
+		Execute_PauseInteraction(this, archetypeSettings.InteractionProgressExpiration, CausingInteractor);
+	}
+	else
+	{
+		Execute_InteractionCanceled(this);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionCanceled_Implementation()
+{
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (Execute_CanInteract(this))
+		{		
+			GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
+			GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+			
+			SetPresentationFlags(EInteractablePresentationFlags::EIPF_InteractionActive | EInteractablePresentationFlags::EIPF_InteractionPaused, false);
+			SetPresentationFlags(EInteractablePresentationFlags::EIPF_InteractionCanceled, true);
+		
+			switch (InteractableState)
+			{
+				case EInteractableStateV2::EIS_Cooldown:
+				case EInteractableStateV2::EIS_Awake:
+					if (Execute_GetInteractor(this).GetObject() == nullptr)
+					{
+						Execute_SetState(this, DefaultInteractableState);
+					}
+					break;
+				case EInteractableStateV2::EIS_Active:
+				case EInteractableStateV2::EIS_Asleep:
+				case EInteractableStateV2::EIS_Completed:
+				case EInteractableStateV2::EIS_Disabled:
+				case EInteractableStateV2::EIS_Suppressed:
+					Execute_SetState(this, DefaultInteractableState);
+					break;
+				case EInteractableStateV2::Default:
+				default: break;
+			}
+		
+			Execute_OnInteractionCanceledEvent(this);
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionLifecycleCompleted_Implementation()
+{
+	Execute_SetState(this, EInteractableStateV2::EIS_Completed);
+
+	Execute_OnLifecycleCompletedEvent(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractionCooldownCompleted_Implementation()
+{
+	if (Interactor.GetInterface() != nullptr)
+	{		
+		if (Interactor->Execute_GetActiveInteractable(Interactor.GetObject()) == this)
+		{
+			ProcessToggleActive(true);
+			
+			Execute_SetState(this, EInteractableStateV2::EIS_Awake);
+		}
+		else
+		{
+			ProcessToggleActive(false);
+			Execute_SetState(this, DefaultInteractableState);
+		}
+	}
+	else
+	{
+		ProcessToggleActive(false);
+		Execute_SetState(this, DefaultInteractableState);
+	}
+	
+	Execute_OnCooldownCompletedEvent(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInteractableBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInteractableStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInteractableTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInteractionProgressExpired(const float ExpirationTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (!GetWorld()) return;
+	
+	switch (InteractableState)
+	{
+		case EInteractableStateV2::EIS_Paused:
+			{
+				GetWorld()->GetTimerManager().ClearTimer(Timer_Interaction);
+				GetWorld()->GetTimerManager().ClearTimer(Timer_ProgressExpiration);
+				
+				auto localInteractor = Execute_GetInteractor(this);
+				if (Execute_DoesHaveInteractor(this) && localInteractor.GetObject() && localInteractor->Execute_GetActiveInteractable(localInteractor.GetObject()) == this)
+				{
+					Execute_SetState(this, EInteractableStateV2::EIS_Active);
+				}
+				else
+				{
+					Execute_OnInteractionStoppedEvent(this, ExpirationTime, CausingInteractor);
+				}
+			}
+			break;
+		case EInteractableStateV2::EIS_Active: break;
+		case EInteractableStateV2::EIS_Awake: break;
+		case EInteractableStateV2::EIS_Cooldown: break;
+		case EInteractableStateV2::EIS_Completed: break;
+		case EInteractableStateV2::EIS_Disabled: break;
+		case EInteractableStateV2::EIS_Suppressed: break;
+		case EInteractableStateV2::EIS_Asleep: break;
+		case EInteractableStateV2::Default: break;
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractableComponentActivated(UActorComponent* Component, bool bReset)
+{
+	if (IsActive())
+	{
+		AutoSetup();
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractableSelected_Implementation(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+ 	if (Interactable == this)
+ 	{
+ 		Execute_SetState(this, EInteractableStateV2::EIS_Active);
+ 		NotifyInteractableSelected(Interactable);
+
+ 		if (GetOwner() && GetOwner()->HasAuthority())
+ 		{
+ 			ProcessToggleActive(false);
+ 		}
+ 	}
+	else
+	{
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			ProcessToggleActive(false);
+		}
+		
+		NotifyInteractionCanceled();
+		
+		Execute_SetState(this, DefaultInteractableState);
+		NotifyInteractorLost(Execute_GetInteractor(this));
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractableLost_Implementation(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (Interactable == this)
+	{
+		switch (InteractableState)
+		{
+			case EInteractableStateV2::EIS_Active:
+				Execute_SetState(this, DefaultInteractableState);
+				break;
+			case EInteractableStateV2::EIS_Cooldown:
+			case EInteractableStateV2::EIS_Awake:
+				if (Execute_GetInteractor(this).GetObject() == nullptr)
+				{
+					Execute_SetState(this, DefaultInteractableState);
+				}
+				break;
+			case EInteractableStateV2::EIS_Asleep:
+			case EInteractableStateV2::EIS_Completed:
+			case EInteractableStateV2::EIS_Disabled:
+			case EInteractableStateV2::EIS_Suppressed:
+			case EInteractableStateV2::Default:
+			default: break;
+		}
+		
+		NotifyInteractorLost(Execute_GetInteractor(this));
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::FindAndAddCollisionShapes_Implementation()
+{
+	for (const auto& Itr : GetArchetypeSettings().CollisionOverrides)
+	{
+		if (const auto NewCollision = UMounteaInteractionSystemBFL::FindPrimitiveByName(Itr, GetOwner()))
+		{
+			Execute_AddCollisionComponent(this, NewCollision);
+		}
+		else
+		{
+			if (const auto NewCollisionByTag = UMounteaInteractionSystemBFL::FindPrimitiveByTag(Itr, GetOwner()))
+			{
+				Execute_AddCollisionComponent(this, NewCollisionByTag);
+			}
+			else LOG_ERROR(TEXT("[Actor Interactable Component] Primitive Component '%s' not found!"), *Itr.ToString())
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::FindAndAddHighlightableMeshes_Implementation()
+{
+	// Highlight is cosmetic only, skip looking up Meshes at all
+	if (!AreCosmeticsEnabled()) return;
+	
+	for (const auto& Itr : GetArchetypeSettings().HighlightableOverrides)
+	{
+		if (const auto NewMesh = UMounteaInteractionSystemBFL::FindMeshByName(Itr, GetOwner()))
+		{
+			Execute_AddHighlightableComponent(this, NewMesh);
+			Execute_BindHighlightableMesh(this, NewMesh);
+		}
+		else
+		{
+			if (const auto NewHighlightByTag = UMounteaInteractionSystemBFL::FindMeshByTag(Itr, GetOwner()))
+			{
+				Execute_AddHighlightableComponent(this, NewHighlightByTag);
+				Execute_BindHighlightableMesh(this, NewHighlightByTag);
+			}
+			else
+				LOG_ERROR(TEXT("[Actor Interactable Component] Mesh Component '%s' not found!"), *Itr.ToString())
+		}
+	}
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::TriggerCooldown_Implementation()
+{
+	if (GetArchetypeSettings().LifecycleCount != -1)
+	{
+		const int32 TempRemainingLifecycleCount = RemainingLifecycleCount - 1;
+		RemainingLifecycleCount = FMath::Max(0, TempRemainingLifecycleCount);
+	}
+	
+	if (GetWorld())
+	{
+		if (RemainingLifecycleCount == 0) return false;
+
+		Execute_SetState(this, EInteractableStateV2::EIS_Cooldown);
+
+		FTimerDelegate Delegate;
+		Delegate.BindUObject(this, &ThisClass::OnCooldownCompletedCallback);
+		
+		GetWorld()->GetTimerManager().SetTimer
+		(
+			Timer_Cooldown,
+			Delegate,
+			GetArchetypeSettings().CooldownPeriod,
+			false
+		);
+
+		LOG_INFO(TEXT("[TriggerCooldown] Cooldown triggered"))
+
+		/*
+		for (const auto& Itr : CollisionComponents)
+		{
+			Execute_UnbindCollisionShape(this, Itr);
+		}
+		*/
+
+		NotifyInteractionCycleCompleted(GetWorld()->GetTimeSeconds(), RemainingLifecycleCount, Execute_GetInteractor(this));
+		return true;
+	}
+
+	return false;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ToggleWidgetVisibility_Implementation(const bool IsVisible)
+{
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		SetPresentationFlags(EInteractablePresentationFlags::EIPF_WidgetVisible, IsVisible);
+
+		if (!AreCosmeticsEnabled()) return;
+	}
+
+	if (IsVisible)
+		ProcessShowWidget();
+	else
+		ProcessHideWidget();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::BindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
+{
+	if (!PrimitiveComponent) return;
+
+	FCollisionShapeCache* shapeCache = CachedCollisionShapesSettings.Find(PrimitiveComponent);
+	if (!shapeCache)
+	{
+		// Pre-interaction settings are cached only once, re-binding must not snapshot already modified settings
+		shapeCache = &CachedCollisionShapesSettings.Add
+		(
+			PrimitiveComponent,
+			FCollisionShapeCache(PrimitiveComponent->GetGenerateOverlapEvents(), PrimitiveComponent->GetCollisionEnabled(), PrimitiveComponent->GetCollisionResponseToChannel(CollisionChannel), PrimitiveComponent->GetCollisionObjectType())
+		);
+	}
+
+	FCollisionShapeBinding& shapeBinding = CollisionShapeBindings.FindOrAdd(PrimitiveComponent);
+	if (!shapeBinding.bDelegatesBound)
+	{
+		BindCollisionShapeDelegates(PrimitiveComponent);
+		shapeBinding.bDelegatesBound = true;
+	}
+
+	SetCollisionShapeActive(PrimitiveComponent, shapeBinding, true);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::UnbindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const
+{
+	if(!PrimitiveComponent) return;
+
+	if (FCollisionShapeBinding* shapeBinding = CollisionShapeBindings.Find(PrimitiveComponent))
+	{
+		SetCollisionShapeActive(PrimitiveComponent, *shapeBinding, false);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::BindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const
+{
+	PrimitiveComponent->OnComponentBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnInteractableBeginOverlap);
+	PrimitiveComponent->OnComponentEndOverlap.AddUniqueDynamic(this, &ThisClass::OnInteractableStopOverlap);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::UnbindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const
+{
+	PrimitiveComponent->OnComponentBeginOverlap.RemoveDynamic(this, &ThisClass::OnInteractableBeginOverlap);
+	PrimitiveComponent->OnComponentEndOverlap.RemoveDynamic(this, &ThisClass::OnInteractableStopOverlap);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::IsCollisionShapeActive(const UPrimitiveComponent* PrimitiveComponent) const
+{
+	const FCollisionShapeBinding* shapeBinding = CollisionShapeBindings.Find(PrimitiveComponent);
+	return shapeBinding && shapeBinding->bQueryActive;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetCollisionShapeActive(UPrimitiveComponent* PrimitiveComponent, FCollisionShapeBinding& ShapeBinding, const bool bActive) const
+{
+	ShapeBinding.bQueryActive = bActive;
+	
+	if (ShapeBinding.bQueryActive == ShapeBinding.bQueryApplied) return;
+
+	PendingCollisionShapes.AddUnique(PrimitiveComponent);
+
+	UWorld* world = GetWorld();
+	if (!world || !world->IsGameWorld())
+	{
+		FlushCollisionShapes();
+		return;
+	}
+
+	FTimerManager& timerManager = world->GetTimerManager();
+	if (!timerManager.TimerExists(Timer_CollisionFlush))
+	{
+		Timer_CollisionFlush = timerManager.SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ThisClass::FlushCollisionShapes));
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::FlushCollisionShapes() const
+{
+	Timer_CollisionFlush.Invalidate();
+	
+	for (const auto& Itr : PendingCollisionShapes)
+	{
+		UPrimitiveComponent* primitiveComponent = Itr.Get();
+		if (!primitiveComponent) continue;
+
+		// Shape could be toggled back and forth within the same frame, then nothing has to be applied
+		const FCollisionShapeCache* shapeCache = CachedCollisionShapesSettings.Find(primitiveComponent);
+		FCollisionShapeBinding* shapeBinding = CollisionShapeBindings.Find(primitiveComponent);
+		if (shapeCache && shapeBinding && shapeBinding->bQueryActive != shapeBinding->bQueryApplied)
+		{
+			ApplyCollisionShape(primitiveComponent, *shapeCache, *shapeBinding);
+		}
+	}
+
+	PendingCollisionShapes.Reset();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ApplyCollisionShape(UPrimitiveComponent* PrimitiveComponent, const FCollisionShapeCache& ShapeCache, FCollisionShapeBinding& ShapeBinding) const
+{
+	// Every setter dirties physics body, so only changed values are set
+	const bool bGenerateOverlapEvents = ShapeBinding.bQueryActive ? true : static_cast<bool>(ShapeCache.bGenerateOverlapEvents);
+	const ECollisionResponse collisionResponse = ShapeBinding.bQueryActive ? ECollisionResponse::ECR_Overlap : ShapeCache.CollisionResponse.GetValue();
+	
+	ECollisionEnabled::Type collisionEnabled = ShapeCache.CollisionEnabled;
+	if (ShapeBinding.bQueryActive)
+	{
+		collisionEnabled = PrimitiveComponent->GetCollisionEnabled() == ECollisionEnabled::NoCollision ? ECollisionEnabled::QueryOnly : PrimitiveComponent->GetCollisionEnabled();
+	}
+
+	if (PrimitiveComponent->GetGenerateOverlapEvents() != bGenerateOverlapEvents)
+	{
+		PrimitiveComponent->SetGenerateOverlapEvents(bGenerateOverlapEvents);
+	}
+	
+	if (PrimitiveComponent->GetCollisionEnabled() != collisionEnabled)
+	{
+		PrimitiveComponent->SetCollisionEnabled(collisionEnabled);
+	}
+	
+	if (PrimitiveComponent->GetCollisionResponseToChannel(CollisionChannel) != collisionResponse)
+	{
+		PrimitiveComponent->SetCollisionResponseToChannel(CollisionChannel, collisionResponse);
+	}
+
+	// Trace Interactors query Interactable Object Type, so physics returns only bound Collision Shapes
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const ECollisionChannel interactableObjectType = interactionSettings ? interactionSettings->GetInteractableObjectType() : ECC_MAX;
+	const ECollisionChannel objectType = ShapeBinding.bQueryActive && interactableObjectType != ECC_MAX ? interactableObjectType : ShapeCache.ObjectType.GetValue();
+	
+	if (PrimitiveComponent->GetCollisionObjectType() != objectType)
+	{
+		PrimitiveComponent->SetCollisionObjectType(objectType);
+	}
+
+	ShapeBinding.bQueryApplied = ShapeBinding.bQueryActive;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ReleaseCollisionShape(UPrimitiveComponent* PrimitiveComponent) const
+{
+	if (!PrimitiveComponent) return;
+
+	const FCollisionShapeCache* shapeCache = CachedCollisionShapesSettings.Find(PrimitiveComponent);
+	FCollisionShapeBinding* shapeBinding = CollisionShapeBindings.Find(PrimitiveComponent);
+	
+	if (shapeBinding)
+	{
+		if (shapeBinding->bDelegatesBound)
+		{
+			UnbindCollisionShapeDelegates(PrimitiveComponent);
+		}
+
+		shapeBinding->bQueryActive = false;
+		if (shapeCache && shapeBinding->bQueryApplied)
+		{
+			ApplyCollisionShape(PrimitiveComponent, *shapeCache, *shapeBinding);
+		}
+	}
+
+	PendingCollisionShapes.Remove(PrimitiveComponent);
+	CachedCollisionShapesSettings.Remove(PrimitiveComponent);
+	CollisionShapeBindings.Remove(PrimitiveComponent);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetInteractableArchetype(UMounteaInteractableArchetype* NewArchetype)
+{
+	if (InteractableArchetype == NewArchetype && ArchetypeOverride == nullptr) return;
+
+	ResetArchetypeOverride();
+	InteractableArchetype = NewArchetype;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ResetArchetypeOverride()
+{
+	if (ArchetypeOverride == nullptr) return;
+
+	if (IsUsingRegisteredSubObjectList())
+	{
+		RemoveReplicatedSubObject(ArchetypeOverride);
+	}
+	
+	ArchetypeOverride = nullptr;
+}
+
+const FInteractableArchetypeSettings& MOUNTEA_INTERACTABLE_CLASS::GetArchetypeSettings() const
+{
+	return GetResolvedArchetype()->Settings;
+}
+
+const UMounteaInteractableArchetype* MOUNTEA_INTERACTABLE_CLASS::GetResolvedArchetype() const
+{
+	if (ArchetypeOverride)
+	{
+		return ArchetypeOverride;
+	}
+	if (InteractableArchetype)
+	{
+		return InteractableArchetype;
+	}
+	return GetClassArchetype();
+}
+
+FInteractableArchetypeSettings& MOUNTEA_INTERACTABLE_CLASS::EditArchetypeSettings()
+{
+	if (ArchetypeOverride == nullptr)
+	{
+		UMounteaInteractableArchetype* newOverride = NewObject<UMounteaInteractableArchetype>(this, NAME_None, RF_Transactional);
+		newOverride->Settings = GetArchetypeSettings();
+		
+		ArchetypeOverride = newOverride;
+
+		if (GetOwner() && GetOwner()->HasAuthority() && IsUsingRegisteredSubObjectList())
+		{
+			AddReplicatedSubObject(ArchetypeOverride);
+		}
+	}
+	
+	return ArchetypeOverride->Settings;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const
+{
+	const FInteractableBaseSettings defaultSettings = UActorInteractionFunctionLibrary::GetDefaultInteractableSettings();
+	
+	Settings.HighlightType				= defaultSettings.DefaultHighlightSetup.HighlightType;
+	Settings.StencilID						= defaultSettings.DefaultHighlightSetup.StencilID;
+	Settings.HighlightMaterial			= defaultSettings.DefaultHighlightSetup.HighlightMaterial;
+	Settings.InteractionPeriod			= defaultSettings.DefaultInteractionPeriod;
+	Settings.CooldownPeriod			= defaultSettings.DefaultCooldownPeriod;
+	Settings.bInteractionHighlight	= defaultSettings.DefaultInteractionHighlight;
+	Settings.InteractableCompatibleTags.AddTag(defaultSettings.InteractableMainTag);
+}
+
+const UMounteaInteractableArchetype* MOUNTEA_INTERACTABLE_CLASS::GetClassArchetype() const
+{
+	// Blueprint Classes share Archetype of their native parent, their own defaults are expected in Interactable Archetype
+	const UClass* nativeClass = GetClass();
+	while (nativeClass && !nativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		nativeClass = nativeClass->GetSuperClass();
+	}
+
+	static TMap<const UClass*, UMounteaInteractableArchetype*> ClassArchetypes;
+	if (UMounteaInteractableArchetype* const* cachedArchetype = ClassArchetypes.Find(nativeClass))
+	{
+		return *cachedArchetype;
+	}
+
+	UMounteaInteractableArchetype* classArchetype = NewObject<UMounteaInteractableArchetype>(GetTransientPackage(), NAME_None, RF_Transient);
+	classArchetype->AddToRoot();
+	
+	nativeClass->GetDefaultObject<ThisClass>()->InitializeArchetypeDefaults(classArchetype->Settings);
+	classArchetype->Settings.Sanitize();
+
+	ClassArchetypes.Add(nativeClass, classArchetype);
+	return classArchetype;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::BindHighlightableMesh_Implementation(UMeshComponent* MeshComponent) const
+{
+	if (!MeshComponent) return;
+	
+	MeshComponent->SetRenderCustomDepth(true);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::UnbindHighlightableMesh_Implementation(UMeshComponent* MeshComponent) const
+{
+	if (!MeshComponent) return;
+	
+	MeshComponent->SetRenderCustomDepth(false);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ToggleDebug_Implementation()
+{
+	FDebugSettings& debugSettings = EditArchetypeSettings().DebugSettings;
+	debugSettings.DebugMode = !debugSettings.DebugMode;
+}
+
+FDebugSettings MOUNTEA_INTERACTABLE_CLASS::GetDebugSettings_Implementation() const
+{
+	return GetArchetypeSettings().DebugSettings;
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::AutoSetup()
+{
+	switch (SetupType)
+	{
+		case ESetupType::EST_FullAll:
+			{
+				if (GetOwner() == nullptr) break;
+
+				TArray<UPrimitiveComponent*> OwnerPrimitives;
+				GetOwner()->GetComponents(OwnerPrimitives);
+
+				TArray<UMeshComponent*> OwnerMeshes;
+				GetOwner()->GetComponents(OwnerMeshes);
+
+				for (const auto& Itr : OwnerPrimitives)
+				{
+					if (Itr)
+					{
+						Execute_AddCollisionComponent(this, Itr);
+					}
+				}
+
+				for (const auto& Itr : OwnerMeshes)
+				{
+					if (Itr)
+					{
+						Execute_AddHighlightableComponent(this, Itr);
+					}
+				}
+			}
+			break;
+		case ESetupType::EST_AllParent:
+			{
+				// Get all Parent Components
+				TArray<USceneComponent*> ParentComponents;
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+				GetParentComponents(ParentComponents);
+#else
+				// Prompt Component attachment stands in for own attachment, otherwise Owner's Root is used
+				if (PromptComponent)
+				{
+					PromptComponent->GetParentComponents(ParentComponents);
+				}
+				else if (GetOwner() && GetOwner()->GetRootComponent())
+				{
+					ParentComponents.Add(GetOwner()->GetRootComponent());
+				}
+#endif
+
+				// Iterate over them and assign them properly
+				if (ParentComponents.Num() > 0)
+				{
+					for (const auto& Itr : ParentComponents)
+					{
+						if (UPrimitiveComponent* PrimitiveComp = Cast<UPrimitiveComponent>(Itr))
+						{
+							Execute_AddCollisionComponent(this, PrimitiveComp);
+
+							if (UMeshComponent* MeshComp = Cast<UMeshComponent>(PrimitiveComp))
+							{
+								Execute_AddHighlightableComponent(this, MeshComp);
+							}
+						}
+					}
+				}
+			}
+			break;
+		case ESetupType::EST_Quick:
+			{
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+				USceneComponent* ParentComponent = GetAttachParent();
+#else
+				// Prompt Component attachment stands in for own attachment, otherwise Owner's Root is used
+				USceneComponent* ParentComponent = PromptComponent ? PromptComponent->GetAttachParent() : (GetOwner() ? GetOwner()->GetRootComponent() : nullptr);
+#endif
+				if (ParentComponent)
+				{
+					if (UPrimitiveComponent* PrimitiveComp = Cast<UPrimitiveComponent>(ParentComponent))
+					{
+						Execute_AddCollisionComponent(this, PrimitiveComp);
+
+						if (UMeshComponent* MeshComp = Cast<UMeshComponent>(PrimitiveComp))
+						{
+							Execute_AddHighlightableComponent(this, MeshComp);
+						}
+					}
+				}
+			}
+			break;
+		default:
+			break;
+	}
+	
+	Execute_FindAndAddCollisionShapes(this);
+	Execute_FindAndAddHighlightableMeshes(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnCooldownCompletedCallback()
+{
+	if (!GetWorld())
+	{
+		LOG_ERROR(TEXT("[TriggerCooldown] Interactable has no World, cannot request OnCooldownCompletedEvent!"))
+		return;
+	}
+	
+	for (const auto& Itr : CollisionComponents)
+	{
+		Execute_BindCollisionShape(this, Itr);
+	}
+	
+	NotifyCooldownCompleted();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractableDependencyStartedCallback_Implementation(const TScriptInterface<IActorInteractableInterface>& NewMaster)
+{
+	if (NewMaster.GetObject() == nullptr) return;
+
+	// Force lower weight but never higher than it was before.
+	const int32 NewWeight = FMath::Min(InteractionWeight, NewMaster->Execute_GetInteractableWeight(this) - 1);
+	Execute_SetInteractableWeight(this, NewWeight);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractableDependencyStoppedCallback_Implementation(const TScriptInterface<IActorInteractableInterface>& FormerMaster)
+{
+	Execute_SetInteractableWeight(this, CachedInteractionWeight);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetPresentationFlags(const EInteractablePresentationFlags Flags, const bool bEnabled)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	if (PresentationState.SetFlags(Flags, bEnabled))
+	{
+		MarkPresentationStateDirty();
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetPresentationInteractor(const TScriptInterface<IActorInteractorInterface>& NewInteractor)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	if (PresentationState.Interactor == NewInteractor) return;
+
+	PresentationState.Interactor = NewInteractor;
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_Interaction, false);
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_InteractorFound, NewInteractor.GetObject() != nullptr);
+
+	MarkPresentationStateDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetPresentationInteractionStarted(const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !GetWorld()) return;
+
+	// Subclasses arm Interaction Timer with their own Period, resumed Timer already has progress
+	const FTimerManager& timerManager = GetWorld()->GetTimerManager();
+	const bool bHasTimer = timerManager.TimerExists(Timer_Interaction);
+	const float elapsedTime = bHasTimer ? FMath::Max(0.f, timerManager.GetTimerElapsed(Timer_Interaction)) : 0.f;
+	const float interactionPeriod = bHasTimer ? timerManager.GetTimerRate(Timer_Interaction) : GetArchetypeSettings().InteractionPeriod;
+	const float serverTime = GetWorld()->GetTimeSeconds();
+
+	// Continued Interaction, e.g. repeated Mash presses, is sent again only once its Progress moves to another bucket
+	if (PresentationState.HasFlags(EInteractablePresentationFlags::EIPF_InteractionActive) && PresentationState.Interactor == CausingInteractor
+		&& FMath::IsNearlyEqual(PresentationState.InteractionPeriod, interactionPeriod))
+	{
+		FInteractablePresentationState continuedState = PresentationState;
+		continuedState.ServerStartTime = serverTime - elapsedTime;
+
+		if (continuedState.GetProgressBucket(serverTime) == PresentationState.GetProgressBucket(serverTime)) return;
+	}
+
+	PresentationState.Interactor = CausingInteractor;
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_InteractionPaused | EInteractablePresentationFlags::EIPF_InteractionCanceled, false);
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_InteractorFound | EInteractablePresentationFlags::EIPF_InteractionActive, true);
+	PresentationState.InteractionPeriod = interactionPeriod;
+	PresentationState.ServerStartTime = serverTime - elapsedTime;
+	PresentationState.PausedAt = -1.f;
+	PresentationState.InteractionSerial++;
+
+	MarkPresentationStateDirty();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::SetPresentationInteractionStopped(const bool bPaused)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !GetWorld()) return;
+
+	if (!PresentationState.HasFlags(EInteractablePresentationFlags::EIPF_InteractionActive)) return;
+
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_InteractionActive, false);
+	PresentationState.SetFlags(EInteractablePresentationFlags::EIPF_InteractionPaused, bPaused);
+	PresentationState.PausedAt = bPaused ? GetWorld()->GetTimeSeconds() : -1.f;
+
+	MarkPresentationStateDirty();
+}
+
+float MOUNTEA_INTERACTABLE_CLASS::GetServerWorldTime() const
+{
+	if (!GetWorld()) return 0.f;
+
+	const AGameStateBase* gameState = GetWorld()->GetGameState();
+	return gameState ? gameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::MarkPresentationStateDirty()
+{
+	INC_DWORD_STAT(STAT_MounteaInteraction_PresentationUpdates);
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PresentationState, this);
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::IsPresentedLocally(const TScriptInterface<IActorInteractorInterface>& PresentedInteractor) const
+{
+	const UActorComponent* interactorComponent = Cast<UActorComponent>(PresentedInteractor.GetObject());
+	const AActor* interactorOwner = interactorComponent ? interactorComponent->GetOwner() : nullptr;
+
+	return interactorOwner && interactorOwner->HasLocalNetOwner();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnRep_PresentationState()
+{
+	const FInteractablePresentationState previousState = AppliedPresentationState;
+	AppliedPresentationState = PresentationState;
+
+	if (!GetWorld()) return;
+
+	// Other Clients' Interactors are not presented, state of no longer presented Interactor is unwound
+	const EInteractablePresentationFlags previousFlags = IsPresentedLocally(previousState.Interactor) ? previousState.GetFlags() : EInteractablePresentationFlags::EIPF_None;
+	const EInteractablePresentationFlags currentFlags = IsPresentedLocally(PresentationState.Interactor) ? PresentationState.GetFlags() : EInteractablePresentationFlags::EIPF_None;
+
+	if (previousFlags == EInteractablePresentationFlags::EIPF_None && currentFlags == EInteractablePresentationFlags::EIPF_None) return;
+
+	auto wasSet = [previousFlags](const EInteractablePresentationFlags Flag) { return EnumHasAnyFlags(previousFlags, Flag); };
+	auto isSet = [currentFlags](const EInteractablePresentationFlags Flag) { return EnumHasAnyFlags(currentFlags, Flag); };
+
+	const bool bInteractorChanged = previousState.Interactor != PresentationState.Interactor;
+
+	if (wasSet(EInteractablePresentationFlags::EIPF_InteractorFound) && (!isSet(EInteractablePresentationFlags::EIPF_InteractorFound) || bInteractorChanged))
+	{
+		NotifyInteractorLost(previousState.Interactor);
+		NotifyInteractionCanceled();
+	}
+
+	if (isSet(EInteractablePresentationFlags::EIPF_InteractorFound) && (!wasSet(EInteractablePresentationFlags::EIPF_InteractorFound) || bInteractorChanged))
+	{
+		NotifyInteractorFound(PresentationState.Interactor);
+	}
+
+	if (isSet(EInteractablePresentationFlags::EIPF_WidgetVisible) != wasSet(EInteractablePresentationFlags::EIPF_WidgetVisible))
+	{
+		if (isSet(EInteractablePresentationFlags::EIPF_WidgetVisible))
+			ProcessShowWidget();
+		else
+			ProcessHideWidget();
+	}
+
+	if (isSet(EInteractablePresentationFlags::EIPF_Highlighted) != wasSet(EInteractablePresentationFlags::EIPF_Highlighted))
+	{
+		if (isSet(EInteractablePresentationFlags::EIPF_Highlighted))
+			ProcessStartHighlight();
+		else
+			ProcessStopHighlight();
+	}
+
+	// Interaction Progress is reconstructed from Presentation State, no local Timer is needed
+	if (wasSet(EInteractablePresentationFlags::EIPF_InteractionActive) && !isSet(EInteractablePresentationFlags::EIPF_InteractionActive))
+	{
+		NotifyInteractionStopped(GetWorld()->GetTimeSeconds(), previousState.Interactor);
+	}
+
+	if (isSet(EInteractablePresentationFlags::EIPF_InteractionCanceled) && !wasSet(EInteractablePresentationFlags::EIPF_InteractionCanceled) && !bInteractorChanged)
+	{
+		NotifyInteractionCanceled();
+	}
+
+	const bool bStarted = isSet(EInteractablePresentationFlags::EIPF_InteractionActive) && (!wasSet(EInteractablePresentationFlags::EIPF_InteractionActive) || previousState.InteractionSerial != PresentationState.InteractionSerial);
+	if (bStarted && PresentationState.Interactor.GetInterface())
+	{
+		// Just to keep everything safe LOCALLY update Interactor
+		if (Interactor != PresentationState.Interactor)
+		{
+			Interactor = PresentationState.Interactor;
+			RefreshTriggerFlags();
+		}
+
+		Interactor->GetInputActionConsumedHandle().AddUniqueDynamic(this, &ThisClass::InteractorActionConsumed);
+
+		NotifyInteractionStarted(PresentationState.ServerStartTime, PresentationState.Interactor);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnRep_InteractableState()
+{
+	RefreshTriggerFlags();
+
+	switch (InteractableState)
+	{
+		case EInteractableStateV2::EIS_Active:
+		case EInteractableStateV2::EIS_Awake:
+		{
+			break;
+		}
+		case EInteractableStateV2::EIS_Paused:
+		case EInteractableStateV2::EIS_Suppressed:
+		case EInteractableStateV2::EIS_Cooldown:
+		case EInteractableStateV2::EIS_Disabled:	
+		case EInteractableStateV2::EIS_Completed:
+		case EInteractableStateV2::EIS_Asleep:
+		case EInteractableStateV2::Default: 
+		default:
+		{
+			Execute_StopHighlight(this);
+			break;
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnRep_ActiveInteractor()
+{
+	RefreshTriggerFlags();
+
+	if (Interactor.GetObject() == nullptr)
+	{
+		Execute_ToggleWidgetVisibility(this, false);
+
+		Execute_StopHighlight(this);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ProcessToggleActive(const bool bIsEnabled)
+{
+	if (bIsEnabled)
+	{
+		Execute_ToggleWidgetVisibility(this, true);
+		Execute_StartHighlight(this);
+	}
+	else
+	{
+		Execute_ToggleWidgetVisibility(this, false);
+		Execute_StopHighlight(this);
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ProcessStartHighlight()
+{
+	MOUNTEA_INTERACTION_SCOPE(ProcessStartHighlight, STAT_MounteaInteraction_Highlight);
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	SetHiddenInGame(false, true);
+#endif
+	const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+	switch (archetypeSettings.HighlightType)
+	{
+		case EHighlightType::EHT_PostProcessing:
+			{
+				for (const auto Itr : HighlightableComponents)
+				{
+					Itr->SetRenderCustomDepth(archetypeSettings.bInteractionHighlight);
+					Itr->SetCustomDepthStencilValue(archetypeSettings.StencilID);
+				}
+			}
+			break;
+		case EHighlightType::EHT_OverlayMaterial:
+			{
+				for (const auto Itr : HighlightableComponents)
+				{
+					Itr->SetOverlayMaterial(archetypeSettings.HighlightMaterial);
+				}
+			}
+		case EHighlightType::EHT_Default:
+		default:
+			break;
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::ProcessStopHighlight()
+{
+	MOUNTEA_INTERACTION_SCOPE(ProcessStopHighlight, STAT_MounteaInteraction_Highlight);
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	SetHiddenInGame(true, true);
+#endif
+	switch (GetArchetypeSettings().HighlightType)
+	{
+		case EHighlightType::EHT_PostProcessing:
+			{
+				for (const auto Itr : HighlightableComponents)
+				{
+					Itr->SetCustomDepthStencilValue(0);
+				}
+			}
+			break;
+		case EHighlightType::EHT_OverlayMaterial:
+			{
+				for (const auto Itr : HighlightableComponents)
+				{
+					Itr->SetOverlayMaterial(nullptr);
+				}
+			}
+		case EHighlightType::EHT_Default:
+		default:
+			break;
+	}
+}
+
+bool MOUNTEA_INTERACTABLE_CLASS::AreCosmeticsEnabled() const
+{
+	return HasBegunPlay() ? bCosmeticsEnabled : UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld());
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::InteractorActionConsumed(UInputAction* ConsumedAction)
+{
+	OnInputActionConsumed.Broadcast(ConsumedAction);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInputModeChanged(ECommonInputType CommonInput)
+{
+	if (AreCosmeticsEnabled())
+	{
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+		const auto localPlayer = GetWidget() ? GetWidget()->GetOwningLocalPlayer() : nullptr;
+#else
+		const auto localPlayer = UMounteaInteractionSystemBFL::FindLocalPlayer(GetOwner());
+#endif
+		if (localPlayer)
+		{
+			if (UCommonInputSubsystem* commonInputSubsystem = UCommonInputSubsystem::Get(localPlayer))
+			{
+
+				const auto currentInputType = commonInputSubsystem->GetCurrentInputType();
+				const auto currentInputName = commonInputSubsystem->GetCurrentGamepadName();
+				
+				NotifyInteractionDeviceChanged(currentInputType, currentInputName);
+			}
+		}
+	}
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::OnInputDeviceChanged_Implementation(const ECommonInputType DeviceType, const FName& DeviceName)
+{
+	FString InputTypeString = GetEnumValueAsString<ECommonInputType>("ECommonInputType", DeviceType);
+}
+
+#pragma region NativeDispatch
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableSelected(const TScriptInterface<IActorInteractableInterface>& SelectedInteractable)
+{
+	if (HasBegunPlay()) Execute_OnInteractableSelectedEvent(this, SelectedInteractable);
+	OnInteractableSelected.Broadcast(SelectedInteractable);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorFound(const TScriptInterface<IActorInteractorInterface>& FoundInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractorFound(this, FoundInteractor);
+	OnInteractorFound.Broadcast(FoundInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorLost(const TScriptInterface<IActorInteractorInterface>& LostInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractorLost(this, LostInteractor);
+	OnInteractorLost.Broadcast(LostInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	if (HasBegunPlay()) Execute_OnInteractableBeginOverlapEvent(this, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+	OnInteractorOverlapped.Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	if (HasBegunPlay()) Execute_OnInteractableStopOverlapEvent(this, OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
+	OnInteractorStopOverlap.Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	if (HasBegunPlay()) OnInteractableTraced(HitComponent, OtherActor, OtherComp, NormalImpulse, Hit);
+	OnInteractorTraced.Broadcast(HitComponent, OtherActor, OtherComp, NormalImpulse, Hit);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionStarted(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractionStarted(this, TimeStarted, CausingInteractor);
+	OnInteractionStarted.Broadcast(TimeStarted, CausingInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionStopped(const float& TimeStopped, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractionStopped(this, TimeStopped, CausingInteractor);
+	OnInteractionStopped.Broadcast(TimeStopped, CausingInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableDependencyStarted(const TScriptInterface<IActorInteractableInterface>& NewMaster)
+{
+	if (HasBegunPlay()) Execute_InteractableDependencyStartedCallback(this, NewMaster);
+	InteractableDependencyStarted.Broadcast(NewMaster);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableDependencyStopped(const TScriptInterface<IActorInteractableInterface>& FormerMaster)
+{
+	if (HasBegunPlay()) Execute_InteractableDependencyStoppedCallback(this, FormerMaster);
+	InteractableDependencyStopped.Broadcast(FormerMaster);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionCompleted(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractionCompleted(this, TimeCompleted, CausingInteractor);
+	OnInteractionCompleted.Broadcast(TimeCompleted, CausingInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionCycleCompleted(const float& CompletedTime, const int32 CyclesRemaining, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+{
+	if (HasBegunPlay()) Execute_InteractionCycleCompleted(this, CompletedTime, CyclesRemaining, CausingInteractor);
+	OnInteractionCycleCompleted.Broadcast(CompletedTime, CyclesRemaining, CausingInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionCanceled()
+{
+	if (HasBegunPlay()) Execute_InteractionCanceled(this);
+	OnInteractionCanceled.Broadcast();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyCooldownCompleted()
+{
+	if (HasBegunPlay()) Execute_InteractionCooldownCompleted(this);
+	OnCooldownCompleted.Broadcast();
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableDependencyChanged(const TScriptInterface<IActorInteractableInterface>& Dependency)
+{
+	if (HasBegunPlay()) OnInteractableDependencyChangedEvent(Dependency);
+	OnInteractableDependencyChanged.Broadcast(Dependency);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableWeightChanged(const int32& NewWeight)
+{
+	if (HasBegunPlay()) OnInteractableWeightChangedEvent(NewWeight);
+	OnInteractableWeightChanged.Broadcast(NewWeight);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableStateChanged(const EInteractableStateV2& NewState)
+{
+	if (HasBegunPlay()) OnInteractableStateChangedEvent(NewState);
+	OnInteractableStateChanged.Broadcast(NewState);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractableCollisionChannelChanged(const ECollisionChannel NewChannel)
+{
+	if (HasBegunPlay()) OnInteractableCollisionChannelChangedEvent(NewChannel);
+	OnInteractableCollisionChannelChanged.Broadcast(NewChannel);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyLifecycleModeChanged(const EInteractableLifecycle& NewMode)
+{
+	if (HasBegunPlay()) OnLifecycleModeChangedEvent(NewMode);
+	OnLifecycleModeChanged.Broadcast(NewMode);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyLifecycleCountChanged(const int32 NewLifecycleCount)
+{
+	if (HasBegunPlay()) OnLifecycleCountChangedEvent(NewLifecycleCount);
+	OnLifecycleCountChanged.Broadcast(NewLifecycleCount);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractorChanged(const TScriptInterface<IActorInteractorInterface>& NewInteractor)
+{
+	if (HasBegunPlay()) OnInteractorChangedEvent(NewInteractor);
+	OnInteractorChanged.Broadcast(NewInteractor);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyIgnoredInteractorClassAdded(const TSoftClassPtr<UObject>& IgnoredClass)
+{
+	if (HasBegunPlay()) OnIgnoredClassAdded(IgnoredClass);
+	OnIgnoredInteractorClassAdded.Broadcast(IgnoredClass);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyIgnoredInteractorClassRemoved(const TSoftClassPtr<UObject>& IgnoredClass)
+{
+	if (HasBegunPlay()) OnIgnoredClassRemoved(IgnoredClass);
+	OnIgnoredInteractorClassRemoved.Broadcast(IgnoredClass);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyHighlightableComponentAdded(UMeshComponent* MeshComponent)
+{
+	if (HasBegunPlay()) OnHighlightableComponentAddedEvent(MeshComponent);
+	OnHighlightableComponentAdded.Broadcast(MeshComponent);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyHighlightableComponentRemoved(UMeshComponent* MeshComponent)
+{
+	if (HasBegunPlay()) OnHighlightableComponentRemovedEvent(MeshComponent);
+	OnHighlightableComponentRemoved.Broadcast(MeshComponent);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyCollisionComponentAdded(UPrimitiveComponent* CollisionComp)
+{
+	if (HasBegunPlay()) OnCollisionComponentAddedEvent(CollisionComp);
+	OnCollisionComponentAdded.Broadcast(CollisionComp);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyCollisionComponentRemoved(UPrimitiveComponent* CollisionComp)
+{
+	if (HasBegunPlay()) OnCollisionComponentRemovedEvent(CollisionComp);
+	OnCollisionComponentRemoved.Broadcast(CollisionComp);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyHighlightTypeChanged(const EHighlightType& NewHighlightType)
+{
+	if (HasBegunPlay()) OnHighlightTypeChangedEvent(NewHighlightType);
+	OnHighlightTypeChanged.Broadcast(NewHighlightType);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyHighlightMaterialChanged(UMaterialInterface* NewHighlightMaterial)
+{
+	if (HasBegunPlay()) OnHighlightMaterialChangedEvent(NewHighlightMaterial);
+	OnHighlightMaterialChanged.Broadcast(NewHighlightMaterial);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::NotifyInteractionDeviceChanged(const ECommonInputType DeviceType, const FName& DeviceName)
+{
+	if (HasBegunPlay()) Execute_OnInputDeviceChanged(this, DeviceType, DeviceName);
+	OnInteractionDeviceChanged.Broadcast(DeviceType, DeviceName);
+}
+
+#pragma endregion
+
+#if WITH_EDITOR || WITH_EDITORONLY_DATA
+
+void MOUNTEA_INTERACTABLE_CLASS::SetDefaultValues()
+{
+	Execute_SetDefaults(this);
+}
+
+#endif
+
+void MOUNTEA_INTERACTABLE_CLASS::SetState_Server_Implementation(const EInteractableStateV2 NewState)
+{
+	if (!MounteaInteractionStateMachine::InteractableStateTable.IsValidState(NewState))
+	{
+		LOG_WARNING(TEXT("[SetState_Server] Rejected invalid State %d"), static_cast<int32>(NewState))
+		return;
+	}
+	
+	Execute_SetState(this, NewState);
+}
+
+#if (!UE_BUILD_SHIPPING || WITH_EDITOR)
+#if WITH_EDITOR
+
+void MOUNTEA_INTERACTABLE_CLASS::ResetDefaults()
+{
+	Execute_SetDefaults(this);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = (PropertyChangedEvent.MemberProperty != nullptr) ? PropertyChangedEvent.GetPropertyName() : NAME_None;
+
+	FString interactableName = GetName();
+	// Format Name
+	{
+		if (interactableName.Contains(TEXT("_GEN_VARIABLE")))
+		{
+			interactableName.ReplaceInline(TEXT("_GEN_VARIABLE"), TEXT(""));
+		}
+		if(interactableName.EndsWith(TEXT("_C")) && interactableName.StartsWith(TEXT("Default__")))
+		{
+		
+			interactableName.RightChopInline(9);
+			interactableName.LeftChopInline(2);
+		}
+	}
+	
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(ThisClass, DefaultInteractableState))
+	{
+		if
+		(
+			DefaultInteractableState == EInteractableStateV2::EIS_Active			||
+			DefaultInteractableState == EInteractableStateV2::EIS_Completed	||
+			DefaultInteractableState == EInteractableStateV2::EIS_Cooldown
+		)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": DefaultInteractableState cannot be ")).Append(GetEnumValueAsString("EInteractableStateV2", DefaultInteractableState)).Append(TEXT("!"))
+			);
+			FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("Icons.Error"));
+
+			DefaultInteractableState = EInteractableStateV2::EIS_Awake;
+		}
+	}
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(ThisClass, ArchetypeOverride))
+	{
+		// Newly created Override starts as copy of shared values, not as empty Archetype
+		if (ArchetypeOverride)
+		{
+			ArchetypeOverride->Settings = InteractableArchetype ? InteractableArchetype->Settings : GetClassArchetype()->Settings;
+		}
+	}
+
+	if (PropertyChangedEvent.MemberProperty && PropertyChangedEvent.MemberProperty->GetFName() == GET_MEMBER_NAME_CHECKED(ThisClass, ArchetypeOverride) && ArchetypeOverride)
+	{
+		const FInteractableArchetypeSettings editedSettings = ArchetypeOverride->Settings;
+		ArchetypeOverride->Settings.Sanitize();
+
+		if (editedSettings.LifecycleCount != ArchetypeOverride->Settings.LifecycleCount && ArchetypeOverride->Settings.DebugSettings.EditorDebugMode)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": Cycled LifecycleCount cannot be: ")).Append(FString::FromInt(editedSettings.LifecycleCount)).Append(TEXT("!"))
+			);
+				
+			FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("Icons.Error"));
+		}
+	}
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(FInteractableArchetypeSettings, LifecycleCount) || PropertyName == GET_MEMBER_NAME_CHECKED(ThisClass, InteractableArchetype))
+	{
+		RemainingLifecycleCount = GetArchetypeSettings().LifecycleCount;
+	}
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+	if (PropertyName == TEXT("WidgetClass"))
+	{
+		if (GetWidgetClass() == nullptr)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": Widget Class is NULL!"))
+			);
+			FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("Icons.Error"));
+		}
+		else
+		{
+			if (GetWidgetClass()->ImplementsInterface(UActorInteractionWidget::StaticClass()) == false)
+			{
+				const FText ErrorMessage = FText::FromString
+				(
+					interactableName.Append(TEXT(": Widget Class must either implement 'ActorInteractionWidget Interface'!"))
+				);
+
+				SetWidgetClass(nullptr);
+				FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("Icons.Error"));
+			}
+		}
+	}
+
+	if (PropertyName == TEXT("Space"))
+	{
+		if (GetWidgetSpace() == EWidgetSpace::World)
+		{
+			SetWorldScale3D(FVector(0.01f));
+			SetDrawSize(FVector2D(2000));
+			bDrawAtDesiredSize = false;
+		}
+		else
+		{
+			SetWorldScale3D(FVector(1.f));
+			bDrawAtDesiredSize = false;
+		}
+
+		const FText ErrorMessage = FText::FromString
+		(
+			interactableName.Append(TEXT(": UI Space changed! Component Scale has been updated. Update 'DrawSize' to match new Widget Space!"))
+		);
+		FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("NotificationList.DefaultMessage"));
+	}
+#endif
+}
+
+EDataValidationResult MOUNTEA_INTERACTABLE_CLASS::IsDataValid(FDataValidationContext& Context) const
+{
+	const auto DefaultValue = Super::IsDataValid(Context);
+	bool bAnyError = false;
+
+	// Validation
+	{
+		FString interactableName = GetName();
+		{
+			if (interactableName.Contains(TEXT("_GEN_VARIABLE")))
+			{
+				interactableName.ReplaceInline(TEXT("_GEN_VARIABLE"), TEXT(""));
+			}
+			if(interactableName.EndsWith(TEXT("_C")) && interactableName.StartsWith(TEXT("Default__")))
+			{
+		
+				interactableName.RightChopInline(9);
+				interactableName.LeftChopInline(2);
+			}
+		}
+	
+		if
+		(
+			DefaultInteractableState == EInteractableStateV2::EIS_Active ||
+			DefaultInteractableState == EInteractableStateV2::EIS_Completed ||
+			DefaultInteractableState == EInteractableStateV2::EIS_Cooldown
+		)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": DefaultInteractableState cannot be ")).Append(GetEnumValueAsString("EInteractableStateV2", DefaultInteractableState)).Append(TEXT("!"))
+			);
+		
+			Context.AddError(ErrorMessage);
+			bAnyError = true;
+		}
+
+		const FInteractableArchetypeSettings& archetypeSettings = GetArchetypeSettings();
+		if (archetypeSettings.InteractionPeriod < -1.f)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": DefaultInteractableState cannot be lesser than -1!"))
+			);
+		
+			Context.AddError(ErrorMessage);
+			bAnyError = true;
+		}
+	
+		if (archetypeSettings.LifecycleMode == EInteractableLifecycle::EIL_Cycled && (archetypeSettings.LifecycleCount == 0 || archetypeSettings.LifecycleCount == 1))
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(":")).Append(TEXT(" LifecycleCount cannot be %d!"), archetypeSettings.LifecycleCount)
+			);
+		
+			Context.AddError(ErrorMessage);
+			bAnyError = true;
+		}
+
+#if MOUNTEA_INTERACTABLE_WITH_WIDGET
+		if (GetWidgetClass() == nullptr)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				interactableName.Append(TEXT(": Widget Class is NULL!"))
+			);
+
+			Context.AddError(ErrorMessage);
+			bAnyError = true;
+		}
+		else
+		{
+			if (GetWidgetClass()->ImplementsInterface(UActorInteractionWidget::StaticClass()) == false)
+			{
+				const FText ErrorMessage = FText::FromString
+				(
+					interactableName.Append(TEXT(" : Widget Class must either implement 'ActorInteractionWidget Interface'!"))
+				);
+
+				Context.AddError(ErrorMessage);
+				bAnyError = true;
+			}
+		}
+#endif
+	}
+
+	if (bAnyError && RequestEditorDefaults.IsBound())
+	{
+		RequestEditorDefaults.Broadcast();
+	}
+
+	if (bAnyError)
+	{
+		Context.AddWarning(FText::FromString("Interactable failed to Validate. `SetDefaults` has been called. Some settings might have been overriden by default values!"));
+	}
+	
+	return bAnyError ? EDataValidationResult::Invalid : DefaultValue;
+}
+
+#endif
+
+void MOUNTEA_INTERACTABLE_CLASS::DrawDebug()
+{
+	if (GetArchetypeSettings().DebugSettings.DebugMode && AreCosmeticsEnabled())
+	{
+		for (const auto& Itr : CollisionComponents)
+		{
+			Itr->SetHiddenInGame(false);
+		}
+	}
+}
+
+#endif
+
+#pragma endregion
+
+bool MOUNTEA_INTERACTABLE_CLASS::CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack)
+{
+	INC_DWORD_STAT(STAT_MounteaInteraction_RPCsSent);
+	
+	return Super::CallRemoteFunction(Function, Parms, OutParms, Stack);
+}
+
+void MOUNTEA_INTERACTABLE_CLASS::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(ThisClass, DefaultInteractableState,			COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(ThisClass, SetupType,									COND_SimulatedOnly);	
+	DOREPLIFETIME_CONDITION(ThisClass, InteractableName,						COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(ThisClass, RemainingLifecycleCount,			COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(ThisClass, InteractionWeight,						COND_SimulatedOnly);
+
+	//DOREPLIFETIME_CONDITION(ThisClass, Timer_Interaction,						COND_SimulatedOnly);
+
+	DOREPLIFETIME_CONDITION(ThisClass, Interactor,									COND_None);	
+	DOREPLIFETIME_CONDITION(ThisClass, InteractableState,						COND_None);	
+	DOREPLIFETIME_CONDITION(ThisClass, InteractableData,						COND_None);
+	DOREPLIFETIME_CONDITION(ThisClass, CollisionChannel,						COND_None);
+	DOREPLIFETIME_CONDITION(ThisClass, InteractableArchetype,				COND_None);
+	DOREPLIFETIME_CONDITION(ThisClass, ArchetypeOverride,					COND_None);
+	DOREPLIFETIME_CONDITION(ThisClass, InteractionHandle,					COND_InitialOnly);
+
+	FDoRepLifetimeParams presentationParams;
+	presentationParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, PresentationState, presentationParams);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,87 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Components/Interactable/ActorInteractableComponentWidgetless.h"
+
+#define MOUNTEA_INTERACTABLE_CLASS UActorInteractableComponentWidgetless
+#define MOUNTEA_INTERACTABLE_WITH_WIDGET 0
+#include "ActorInteractableComponentShared.inl"
+#undef MOUNTEA_INTERACTABLE_WITH_WIDGET
+#undef MOUNTEA_INTERACTABLE_CLASS
+
+bool UActorInteractableComponentWidgetless::ValidateInteractable() const
+{
+	// Interactables without Prompt are valid, they never show any Widget
+	if (PromptComponent && !PromptComponent->ValidatePrompt())
+	{
+		LOG_ERROR(TEXT("[%s] Has invalid Prompt Component! Disabled!"), *GetName())
+		return false;
+	}
+
+	return true;
+}
+
+void UActorInteractableComponentWidgetless::UpdateInteractionWidget()
+{
+	MOUNTEA_INTERACTION_SCOPE(UpdateInteractionWidget, STAT_MounteaInteraction_WidgetUpdate);
+	INC_DWORD_STAT(STAT_MounteaInteraction_WidgetUpdates);
+
+	if (PromptComponent)
+	{
+		PromptComponent->UpdatePrompt(this);
+	}
+}
+
+void UActorInteractableComponentWidgetless::ProcessShowWidget()
+{
+	MOUNTEA_INTERACTION_SCOPE(UpdateInteractionWidget, STAT_MounteaInteraction_WidgetUpdate);
+	INC_DWORD_STAT(STAT_MounteaInteraction_WidgetUpdates);
+
+	if (PromptComponent && PromptComponent->ShowPrompt(this))
+	{
+		OnInteractableWidgetVisibilityChanged.Broadcast(true);
+	}
+}
+
+void UActorInteractableComponentWidgetless::ProcessHideWidget()
+{
+	MOUNTEA_INTERACTION_SCOPE(UpdateInteractionWidget, STAT_MounteaInteraction_WidgetUpdate);
+	INC_DWORD_STAT(STAT_MounteaInteraction_WidgetUpdates);
+
+	if (PromptComponent && PromptComponent->HidePrompt(this))
+	{
+		OnInteractableWidgetVisibilityChanged.Broadcast(false);
+	}
+}
+
+TSubclassOf<UUserWidget> UActorInteractableComponentWidgetless::GetInteractableWidgetClass() const
+{
+	return PromptComponent ? PromptComponent->GetWidgetClass() : nullptr;
+}
+
+void UActorInteractableComponentWidgetless::SetPromptComponent(UActorInteractablePromptComponent* NewPromptComponent)
+{
+	if (PromptComponent == NewPromptComponent)
+	{
+		return;
+	}
+
+	bool bWasPresented = false;
+	if (PromptComponent)
+	{
+		bWasPresented = PromptComponent->GetPresentedInteractable().GetObject() == this && PromptComponent->IsVisible();
+		PromptComponent->HidePrompt(this);
+	}
+
+	PromptComponent = NewPromptComponent;
+
+	// Keeps presenting with new Prompt, hidden Prompts get values once shown
+	if (PromptComponent && bWasPresented)
+	{
+		PromptComponent->ShowPrompt(this);
+	}
+}
+
+UActorInteractablePromptComponent* UActorInteractableComponentWidgetless::FindPromptComponent() const
+{
+	return GetOwner() ? GetOwner()->FindComponentByClass<UActorInteractablePromptComponent>() : nullptr;
+}
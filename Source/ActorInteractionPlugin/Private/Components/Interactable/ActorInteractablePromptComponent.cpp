@@ -0,0 +1,230 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Components/Interactable/ActorInteractablePromptComponent.h"
+
+#if WITH_EDITOR
+
+#include "EditorHelper.h"
+#include "Misc/DataValidation.h"
+
+#endif
+
+#include "Blueprint/UserWidget.h"
+
+#include "Helpers/ActorInteractionFunctionLibrary.h"
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/MounteaInteractionSystemBFL.h"
+
+#include "Interfaces/ActorInteractionWidget.h"
+
+UActorInteractablePromptComponent::UActorInteractablePromptComponent()
+{
+	Space = EWidgetSpace::Screen;
+	DrawSize = FIntPoint(64, 64);
+	bDrawAtDesiredSize = false;
+
+	SetHiddenInGame(true);
+}
+
+void UActorInteractablePromptComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Dedicated servers never present any Widget
+	if (!UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UActorInteractablePromptComponent::InitWidget()
+{
+	// Avoids loading default Widget Class on dedicated servers
+	if (!UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		return;
+	}
+
+	if (GetWidgetClass() == nullptr)
+	{
+		SetWidgetClass(GetPromptWidgetClass());
+	}
+
+	Super::InitWidget();
+
+	if (PresentedInteractable.GetObject())
+	{
+		UpdatePrompt(PresentedInteractable);
+	}
+}
+
+bool UActorInteractablePromptComponent::ShowPrompt(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	PresentedInteractable = Interactable;
+
+	if (!GetWidget())
+	{
+		return false;
+	}
+
+	UpdatePrompt(Interactable);
+
+	SetHiddenInGame(false);
+	SetVisibility(true);
+
+	return true;
+}
+
+bool UActorInteractablePromptComponent::HidePrompt(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	if (!GetWidget())
+	{
+		return false;
+	}
+
+	// Shared Prompt already presents another Interactable
+	if (PresentedInteractable.GetObject() && PresentedInteractable.GetObject() != Interactable.GetObject())
+	{
+		return false;
+	}
+
+	UpdatePrompt(Interactable);
+
+	// Hidden Prompt presents nothing, next shown Interactable claims it
+	PresentedInteractable = nullptr;
+
+	SetHiddenInGame(true);
+	SetVisibility(false);
+
+	return true;
+}
+
+void UActorInteractablePromptComponent::UpdatePrompt(const TScriptInterface<IActorInteractableInterface>& Interactable)
+{
+	// Shared Prompt only reflects values of presented Interactable
+	if (PresentedInteractable.GetObject() == nullptr || PresentedInteractable.GetObject() != Interactable.GetObject())
+	{
+		return;
+	}
+
+	if (UUserWidget* userWidget = GetWidget())
+	{
+		if (userWidget->Implements<UActorInteractionWidget>())
+		{
+			IActorInteractionWidget::Execute_UpdateWidget(userWidget, Interactable);
+		}
+	}
+}
+
+bool UActorInteractablePromptComponent::ValidatePrompt() const
+{
+	// Dedicated servers never present any Widget, avoids loading default Widget Class
+	if (!UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(GetWorld()))
+	{
+		return true;
+	}
+
+	const TSubclassOf<UUserWidget> widgetClass = GetPromptWidgetClass();
+	if (widgetClass.Get() == nullptr)
+	{
+		LOG_ERROR(TEXT("[%s] Has null Widget Class and there is no default Widget Class in Project Settings!"), *GetName())
+		return false;
+	}
+
+	if (widgetClass->ImplementsInterface(UActorInteractionWidget::StaticClass()) == false)
+	{
+		LOG_ERROR(TEXT("[%s] Has invalid Widget Class! Widget Class must implament `ActorInteractionWidget` interface!"), *GetName())
+		return false;
+	}
+
+	return true;
+}
+
+TSubclassOf<UUserWidget> UActorInteractablePromptComponent::GetPromptWidgetClass() const
+{
+	if (GetWidgetClass() != nullptr)
+	{
+		return GetWidgetClass();
+	}
+
+	return UActorInteractionFunctionLibrary::GetInteractableDefaultWidgetClass();
+}
+
+#if WITH_EDITOR
+
+void UActorInteractablePromptComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = (PropertyChangedEvent.Property != nullptr) ? PropertyChangedEvent.GetPropertyName() : NAME_None;
+
+	FString promptName = GetName();
+	// Format Name
+	{
+		if (promptName.Contains(TEXT("_GEN_VARIABLE")))
+		{
+			promptName.ReplaceInline(TEXT("_GEN_VARIABLE"), TEXT(""));
+		}
+		if(promptName.EndsWith(TEXT("_C")) && promptName.StartsWith(TEXT("Default__")))
+		{
+			promptName.RightChopInline(9);
+			promptName.LeftChopInline(2);
+		}
+	}
+
+	if (PropertyName == TEXT("WidgetClass"))
+	{
+		if (GetWidgetClass() != nullptr && GetWidgetClass()->ImplementsInterface(UActorInteractionWidget::StaticClass()) == false)
+		{
+			const FText ErrorMessage = FText::FromString
+			(
+				promptName.Append(TEXT(": Widget Class must either implement 'ActorInteractionWidget Interface'!"))
+			);
+
+			SetWidgetClass(nullptr);
+			FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("Icons.Error"));
+		}
+	}
+
+	if (PropertyName == TEXT("Space"))
+	{
+		if (GetWidgetSpace() == EWidgetSpace::World)
+		{
+			SetWorldScale3D(FVector(0.01f));
+			SetDrawSize(FVector2D(2000));
+			bDrawAtDesiredSize = false;
+		}
+		else
+		{
+			SetWorldScale3D(FVector(1.f));
+			bDrawAtDesiredSize = false;
+		}
+
+		const FText ErrorMessage = FText::FromString
+		(
+			promptName.Append(TEXT(": UI Space changed! Component Scale has been updated. Update 'DrawSize' to match new Widget Space!"))
+		);
+		FEditorHelper::DisplayEditorNotification(ErrorMessage, SNotificationItem::CS_Fail, 5.f, 2.f, TEXT("NotificationList.DefaultMessage"));
+	}
+}
+
+EDataValidationResult UActorInteractablePromptComponent::IsDataValid(FDataValidationContext& Context) const
+{
+	const auto DefaultValue = Super::IsDataValid(Context);
+
+	// Null Widget Class falls back to project default Widget Class
+	if (GetWidgetClass() != nullptr && GetWidgetClass()->ImplementsInterface(UActorInteractionWidget::StaticClass()) == false)
+	{
+		const FText ErrorMessage = FText::FromString
+		(
+			GetName().Append(TEXT(" : Widget Class must either implement 'ActorInteractionWidget Interface'!"))
+		);
+
+		Context.AddError(ErrorMessage);
+		return EDataValidationResult::Invalid;
+	}
+
+	return DefaultValue;
+}
+
+#endif
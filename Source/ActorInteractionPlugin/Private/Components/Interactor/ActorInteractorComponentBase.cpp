@@ -15,10 +15,19 @@
 #include "Helpers/InteractionHelpers.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+#include "Helpers/MounteaInteractionStats.h"
+#include "Helpers/MounteaInteractionHandleSubsystem.h"
+#include "Helpers/MounteaInteractionTagBits.h"
 
 #include "Interfaces/ActorInteractableInterface.h"
 
 #include "GameFramework/Actor.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "TimerManager.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
 
@@ -53,6 +62,10 @@ UActorInteractorComponentBase::UActorInteractorComponentBase() :
 void UActorInteractorComponentBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	RegisterInteractionHandle();
+
+	InteractorTagBit = FMounteaInteractionTagBits::GetTagBit(InteractorTag);
 	
 	OnInteractableUpdated.			AddUniqueDynamic(this, &UActorInteractorComponentBase::InteractableSelected);
 	OnInteractableFound.				AddUniqueDynamic(this, &UActorInteractorComponentBase::InteractableFound);
@@ -73,6 +86,38 @@ void UActorInteractorComponentBase::BeginPlay()
 	}	
 }
 
+void UActorInteractorComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseInteractionHandle();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UActorInteractorComponentBase::RegisterInteractionHandle()
+{
+	UMounteaInteractionHandleSubsystem* handleSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+	if (!handleSubsystem || !GetOwner()) return;
+
+	if (GetOwner()->HasAuthority())
+	{
+		InteractionHandle = handleSubsystem->RegisterObject(this);
+	}
+	else
+	{
+		handleSubsystem->BindHandle(InteractionHandle, this);
+	}
+}
+
+void UActorInteractorComponentBase::ReleaseInteractionHandle()
+{
+	if (UMounteaInteractionHandleSubsystem* handleSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr)
+	{
+		handleSubsystem->ReleaseHandle(InteractionHandle);
+	}
+
+	InteractionHandle = FMounteaInteractionHandle();
+}
+
 FString UActorInteractorComponentBase::ToString_Implementation() const
 {
 	TScriptInterface<IActorInteractableInterface> activeInteractable = Execute_GetActiveInteractable(this);
@@ -123,6 +168,9 @@ void UActorInteractorComponentBase::SetSafetyTracingSetup_Implementation(const F
 
 bool UActorInteractorComponentBase::PerformSafetyTrace_Implementation(const AActor* InteractableActor)
 {
+	MOUNTEA_INTERACTION_SCOPE(PerformSafetyTrace, STAT_MounteaInteraction_SafetyTrace);
+	INC_DWORD_STAT(STAT_MounteaInteraction_SafetyTraces);
+
 	if (!InteractableActor)
 		return false;
 
@@ -156,17 +204,35 @@ bool UActorInteractorComponentBase::PerformSafetyTrace_Implementation(const AAct
 			return true;
 	}
 
-	bool bHit = GetWorld()->LineTraceSingleByChannel(safetyTrace, traceStartLocation, InteractableActor->GetActorLocation(), SafetyTraceSetup.ValidationCollisionChannel, queryParams);
+	// Remote Clients are validated against where they have seen the Interactable
+	const FTransform rewoundTransform = GetValidationTransform(InteractableActor);
+	const FVector traceEndLocation = rewoundTransform.GetLocation();
+	const bool bRewound = !traceEndLocation.Equals(InteractableActor->GetActorLocation());
+
+	bool bHit = GetWorld()->LineTraceSingleByChannel(safetyTrace, traceStartLocation, traceEndLocation, SafetyTraceSetup.ValidationCollisionChannel, queryParams);
 
 #if WITH_EDITOR || UE_BUILD_DEBUG
 	if (DebugSettings.DebugMode)
 	{
 		DrawDebugBox(GetWorld(), traceStartLocation, FVector(5.f), FColor::Blue, false, 2.f, 0, 1.f);
-		DrawDebugBox(GetWorld(), InteractableActor->GetActorLocation(), FVector(5.f), FColor::Red, false, 2.f, 0, 1.f);
-		DrawDebugDirectionalArrow(GetWorld(), traceStartLocation, InteractableActor->GetActorLocation(), 2.f, FColor::Purple, false, 2.f, 0, 1.f);
+		DrawDebugBox(GetWorld(), traceEndLocation, FVector(5.f), FColor::Red, false, 2.f, 0, 1.f);
+		DrawDebugDirectionalArrow(GetWorld(), traceStartLocation, traceEndLocation, 2.f, FColor::Purple, false, 2.f, 0, 1.f);
 	}
 #endif
 
+	if (bRewound)
+	{
+		// Rewound Actor is no longer at the end of the trace, anything else hit in between blocks
+		if (bHit && safetyTrace.GetActor() != InteractableActor)
+			return false;
+
+		// Actor itself must still be hit, trace start is expressed relative to its current frame instead of moving it back
+		const FTransform& currentTransform = InteractableActor->GetActorTransform();
+		const FVector rewoundStartLocation = currentTransform.TransformPosition(rewoundTransform.InverseTransformPosition(traceStartLocation));
+
+		bHit = GetWorld()->LineTraceSingleByChannel(safetyTrace, rewoundStartLocation, currentTransform.GetLocation(), SafetyTraceSetup.ValidationCollisionChannel, queryParams);
+	}
+
 	return bHit && safetyTrace.GetActor() == InteractableActor;
 }
 
@@ -178,6 +244,8 @@ void UActorInteractorComponentBase::SetDefaults_Implementation()
 		InteractorTag				= defaultValues.InteractorTag;
 		DefaultInteractorState = defaultValues.DefaultInteractorState;
 	}
+
+	InteractorTagBit = FMounteaInteractionTagBits::GetTagBit(InteractorTag);
 }
 
 void UActorInteractorComponentBase::ConsumeInput_Implementation(UInputAction* ConsumedInput)
@@ -185,11 +253,22 @@ void UActorInteractorComponentBase::ConsumeInput_Implementation(UInputAction* Co
 	OnInputActionConsumed.Broadcast(ConsumedInput);
 }
 
+uint64 UActorInteractorComponentBase::GetInteractorTagBit() const
+{
+	if (InteractorTagBitGeneration != FMounteaInteractionTagBits::GetGeneration())
+	{
+		InteractorTagBit = FMounteaInteractionTagBits::GetTagBit(InteractorTag);
+		InteractorTagBitGeneration = FMounteaInteractionTagBits::GetGeneration();
+	}
+
+	return InteractorTagBit;
+}
+
 void UActorInteractorComponentBase::InteractableSelected_Implementation(const TScriptInterface<IActorInteractableInterface>& SelectedInteractable)
 {
 	if (SelectedInteractable.GetObject())
 	{
-		SelectedInteractable->GetOnInteractableSelectedHandle().Broadcast(SelectedInteractable);
+		SelectedInteractable->NotifyInteractableSelected(SelectedInteractable);
 	}
 	
 	Execute_OnInteractableSelectedEvent(this, SelectedInteractable);
@@ -225,7 +304,7 @@ void UActorInteractorComponentBase::InteractableLost_Implementation(const TScrip
 	
 	if (LostInteractable == ActiveInteractable)
 	{
-		ActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+		ActiveInteractable->NotifyInteractorLost(this);
 		
 		Execute_SetState(this, EInteractorStateV2::EIS_Awake);
 		
@@ -316,12 +395,17 @@ void UActorInteractorComponentBase::StartInteraction_Implementation(const float
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
 		{
 			Execute_SetState(this,EInteractorStateV2::EIS_Active);
-			ActiveInteractable->GetOnInteractionStartedHandle().Broadcast(StartTime, this);
+			ActiveInteractable->NotifyInteractionStarted(StartTime, this);
 		}
 	}
+	else if (ActiveInteractable.GetInterface() && ActiveInteractable->CanBatchInteractionStarts())
+	{
+		BatchInteractionStart(StartTime);
+	}
 	else
 	{
-		StartInteraction_Server(StartTime);
+		FlushInteractionStarts();
+		StartInteraction_Server(StartTime, GetClientViewTime());
 	}
 }
 
@@ -338,11 +422,17 @@ void UActorInteractorComponentBase::StopInteraction_Implementation(const float S
 		if (Execute_CanInteract(this) && ActiveInteractable.GetInterface())
 		{
 			Execute_SetState(this,DefaultInteractorState);
-			ActiveInteractable->GetOnInteractionStoppedHandle().Broadcast(StopTime, this);
+			ActiveInteractable->NotifyInteractionStopped(StopTime, this);
 		}
 	}
+	else if (ActiveInteractable.GetInterface() && ActiveInteractable->CanBatchInteractionStarts())
+	{
+		// Batching Interactables resolve their Interaction by deadlines, Stops would only cost RPCs
+		return;
+	}
 	else
 	{
+		FlushInteractionStarts();
 		StopInteraction_Server(StopTime);
 	}
 }
@@ -575,7 +665,7 @@ void UActorInteractorComponentBase::AddInteractionDependency_Implementation(cons
 	}
 	else
 	{
-		AddInteractionDependency_Server(InteractionDependency);
+		AddInteractionDependency_Server(UMounteaInteractionHandleSubsystem::GetHandle(InteractionDependency.GetObject()));
 	}
 }
 
@@ -600,7 +690,7 @@ void UActorInteractorComponentBase::RemoveInteractionDependency_Implementation(c
 	}
 	else
 	{
-		RemoveInteractionDependency_Server(InteractionDependency);
+		RemoveInteractionDependency_Server(UMounteaInteractionHandleSubsystem::GetHandle(InteractionDependency.GetObject()));
 	}
 }
 
@@ -609,6 +699,8 @@ TArray<TScriptInterface<IActorInteractorInterface>> UActorInteractorComponentBas
 
 void UActorInteractorComponentBase::ProcessDependencies_Implementation()
 {
+	MOUNTEA_INTERACTION_SCOPE(ProcessDependencies, STAT_MounteaInteraction_ProcessDependencies);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[ProcessDependencies] No owner!"));
@@ -691,6 +783,8 @@ EInteractorStateV2 UActorInteractorComponentBase::GetState_Implementation() cons
 
 void UActorInteractorComponentBase::SetState_Implementation(const EInteractorStateV2 NewState)
 {
+	MOUNTEA_INTERACTION_SCOPE(SetState, STAT_MounteaInteraction_InteractorSetState);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[SetState] Interactor has no Owner!"))
@@ -699,86 +793,7 @@ void UActorInteractorComponentBase::SetState_Implementation(const EInteractorSta
 
 	if (GetOwner()->HasAuthority())
 	{
-		switch (NewState)
-		{
-			case EInteractorStateV2::EIS_Awake:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Asleep:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-					case EInteractorStateV2::EIS_Disabled:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Suppressed:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Active:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Awake:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Active:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::EIS_Disabled:
-				switch (InteractorState)
-				{
-					case EInteractorStateV2::EIS_Asleep:
-					case EInteractorStateV2::EIS_Awake:
-					case EInteractorStateV2::EIS_Suppressed:
-					case EInteractorStateV2::EIS_Active:
-						InteractorState = NewState;
-						ProcessStateChanged();
-						break;
-					case EInteractorStateV2::EIS_Disabled:
-					case EInteractorStateV2::Default:
-					default: break;
-				}
-				break;
-			case EInteractorStateV2::Default:
-			default: break;
-		}
+		ApplyStateTransitionEffects(NewState, GetStateTransitionEffects(InteractorState, NewState));
 
 		Execute_ProcessDependencies(this);
 	}
@@ -788,6 +803,23 @@ void UActorInteractorComponentBase::SetState_Implementation(const EInteractorSta
 	}
 }
 
+EInteractorStateEffect UActorInteractorComponentBase::GetStateTransitionEffects(const EInteractorStateV2 FromState, const EInteractorStateV2 ToState) const
+{
+	return MounteaInteractionStateMachine::InteractorStateTable.GetEffects(FromState, ToState);
+}
+
+void UActorInteractorComponentBase::ApplyStateTransitionEffects(const EInteractorStateV2 NewState, const EInteractorStateEffect Effects)
+{
+	if (!EnumHasAnyFlags(Effects, EInteractorStateEffect::ESE_Allowed)) return;
+
+	InteractorState = NewState;
+
+	if (EnumHasAnyFlags(Effects, EInteractorStateEffect::ESE_NotifyStateChanged))
+	{
+		ProcessStateChanged();
+	}
+}
+
 EInteractorStateV2 UActorInteractorComponentBase::GetDefaultState_Implementation() const
 { return DefaultInteractorState; }
 
@@ -849,11 +881,18 @@ void UActorInteractorComponentBase::SetActiveInteractable_Implementation(const T
 			OnInteractableUpdated.Broadcast(ActiveInteractable);
 		}
 
-		SetActiveInteractable_Client(ActiveInteractable);
+		SetActiveInteractable_Client(UMounteaInteractionHandleSubsystem::GetHandle(ActiveInteractable.GetObject()));
 	}
 	else
 	{
-		SetActiveInteractable_Server(NewInteractable);
+		const FMounteaInteractionHandle newInteractableHandle = UMounteaInteractionHandleSubsystem::GetHandle(NewInteractable.GetObject());
+		if (NewInteractable.GetObject() && !newInteractableHandle.IsValid())
+		{
+			LOG_ERROR(TEXT("[SetActiveInteractable] %s has no Interaction Handle and cannot be sent to Server!"), *NewInteractable.GetObject()->GetName())
+			return;
+		}
+
+		SetActiveInteractable_Server(newInteractableHandle);
 	}
 }
 
@@ -888,6 +927,7 @@ void UActorInteractorComponentBase::SetInteractorTag_Implementation(const FGamep
 		if (InteractorTag != NewInteractorTag)
 		{
 			InteractorTag = NewInteractorTag;
+			InteractorTagBit = FMounteaInteractionTagBits::GetTagBit(InteractorTag);
 
 			OnInteractorTagChanged.Broadcast(NewInteractorTag);
 		}
@@ -915,14 +955,14 @@ void UActorInteractorComponentBase::AddIgnoredActor_Server_Implementation(AActor
 	Execute_AddIgnoredActor(this, IgnoredActor);
 }
 
-void UActorInteractorComponentBase::AddInteractionDependency_Server_Implementation(const TScriptInterface<IActorInteractorInterface>& InteractionDependency)
+void UActorInteractorComponentBase::AddInteractionDependency_Server_Implementation(const FMounteaInteractionHandle& InteractionDependency)
 {
-	Execute_AddInteractionDependency(this, InteractionDependency);
+	Execute_AddInteractionDependency(this, UMounteaInteractionHandleSubsystem::Resolve<IActorInteractorInterface>(GetWorld(), InteractionDependency));
 }
 
-void UActorInteractorComponentBase::RemoveInteractionDependency_Server_Implementation(const TScriptInterface<IActorInteractorInterface>& InteractionDependency)
+void UActorInteractorComponentBase::RemoveInteractionDependency_Server_Implementation(const FMounteaInteractionHandle& InteractionDependency)
 {
-	Execute_RemoveInteractionDependency(this, InteractionDependency);
+	Execute_RemoveInteractionDependency(this, UMounteaInteractionHandleSubsystem::Resolve<IActorInteractorInterface>(GetWorld(), InteractionDependency));
 }
 
 void UActorInteractorComponentBase::RemoveIgnoredActor_Server_Implementation(AActor* IgnoredActor)
@@ -950,9 +990,9 @@ void UActorInteractorComponentBase::SetDefaultState_Server_Implementation(const
 	Execute_SetDefaultState(this, NewState);
 }
 
-void UActorInteractorComponentBase::SetActiveInteractable_Server_Implementation(const TScriptInterface<IActorInteractableInterface>& NewInteractable)
+void UActorInteractorComponentBase::SetActiveInteractable_Server_Implementation(const FMounteaInteractionHandle& NewInteractable)
 {
-	Execute_SetActiveInteractable(this, NewInteractable);
+	Execute_SetActiveInteractable(this, UMounteaInteractionHandleSubsystem::Resolve<IActorInteractableInterface>(GetWorld(), NewInteractable));
 }
 
 void UActorInteractorComponentBase::SetInteractorTag_Server_Implementation(const FGameplayTag& NewInteractorTag)
@@ -960,14 +1000,15 @@ void UActorInteractorComponentBase::SetInteractorTag_Server_Implementation(const
 	Execute_SetInteractorTag(this, NewInteractorTag);
 }
 
-void UActorInteractorComponentBase::SetActiveInteractable_Client_Implementation(const TScriptInterface<IActorInteractableInterface>& NewInteractable)
+void UActorInteractorComponentBase::SetActiveInteractable_Client_Implementation(const FMounteaInteractionHandle& NewInteractable)
 {
-	if (NewInteractable.GetObject() != nullptr)
+	const TScriptInterface<IActorInteractableInterface> newInteractable = UMounteaInteractionHandleSubsystem::Resolve<IActorInteractableInterface>(GetWorld(), NewInteractable);
+	if (newInteractable.GetObject() != nullptr)
 	{
-		OnInteractableUpdated.Broadcast(NewInteractable);
+		OnInteractableUpdated.Broadcast(newInteractable);
 	}
 	else
-		OnInteractableLost.Broadcast(NewInteractable);
+		OnInteractableLost.Broadcast(newInteractable);
 }
 
 void UActorInteractorComponentBase::SetSafetyTracingSetup_Server_Implementation(const FSafetyTracingSetup& NewSafetyTracingSetup)
@@ -980,6 +1021,16 @@ void UActorInteractorComponentBase::OnRep_InteractorState()
 	ProcessStateChanged_Client();
 }
 
+void UActorInteractorComponentBase::OnRep_InteractionHandle()
+{
+	RegisterInteractionHandle();
+}
+
+void UActorInteractorComponentBase::OnRep_InteractorTag()
+{
+	InteractorTagBit = FMounteaInteractionTagBits::GetTagBit(InteractorTag);
+}
+
 void UActorInteractorComponentBase::ProcessInteractableChanged()
 {
 	if (ActiveInteractable.GetObject() != nullptr)
@@ -997,6 +1048,8 @@ void UActorInteractorComponentBase::OnRep_ActiveInteractable()
 
 void UActorInteractorComponentBase::ProcessStateChanged()
 {
+	INC_DWORD_STAT(STAT_MounteaInteraction_StateTransitions);
+
 	// Client side call
 	OnStateChanged.Broadcast(InteractorState);
 }
@@ -1008,6 +1061,13 @@ void UActorInteractorComponentBase::ProcessStateChanged_Client()
 	ProcessStateChanged();
 }
 
+bool UActorInteractorComponentBase::CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack)
+{
+	INC_DWORD_STAT(STAT_MounteaInteraction_RPCsSent);
+	
+	return Super::CallRemoteFunction(Function, Parms, OutParms, Stack);
+}
+
 void UActorInteractorComponentBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -1021,6 +1081,7 @@ void UActorInteractorComponentBase::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME_CONDITION(UActorInteractorComponentBase, InteractorState,						COND_None);
 	DOREPLIFETIME_CONDITION(UActorInteractorComponentBase, ActiveInteractable,				COND_None);
 	DOREPLIFETIME_CONDITION(UActorInteractorComponentBase, InteractionDependencies,		COND_None);
+	DOREPLIFETIME_CONDITION(UActorInteractorComponentBase, InteractionHandle,					COND_InitialOnly);
 }
 
 bool UActorInteractorComponentBase::HasInteractable_Implementation() const
@@ -1033,13 +1094,197 @@ void UActorInteractorComponentBase::StopInteraction_Server_Implementation(const
 	Execute_StopInteraction(this, StopTime);
 }
 
-void UActorInteractorComponentBase::StartInteraction_Server_Implementation(const float StartTime)
+void UActorInteractorComponentBase::StartInteraction_Server_Implementation(const float StartTime, const float ViewTime)
 {
+	SetClientViewTime(ViewTime);
+
+	// Separate starts share the same rate limit as batched ones
+	if (ConsumeStartAllowance(1) == 0)
+	{
+		LOG_WARNING(TEXT("[StartInteraction] %s dropped Interaction start above Max Interaction Start Rate"), *GetName())
+		return;
+	}
+
 	Execute_StartInteraction(this, StartTime);
 }
 
+int32 UActorInteractorComponentBase::ConsumeStartAllowance(const int32 RequestedCount)
+{
+	if (!GetWorld() || RequestedCount <= 0) return 0;
+
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const float batchWindow = interactionSettings ? interactionSettings->GetInteractionStartBatchWindow() : 0.f;
+	const float maxStartRate = interactionSettings ? interactionSettings->GetMaxInteractionStartRate() : 20.f;
+	const float currentTime = GetWorld()->GetTimeSeconds();
+
+	// Allowance refills at plausible press rate, at most one Batch Window worth of starts
+	const float maxAllowance = 1.f + maxStartRate * batchWindow;
+	const float refilledAllowance = AcceptedStartAllowanceTime < 0.f ? maxAllowance : AcceptedStartAllowance + (currentTime - AcceptedStartAllowanceTime) * maxStartRate;
+	AcceptedStartAllowance = FMath::Min(maxAllowance, refilledAllowance);
+	AcceptedStartAllowanceTime = currentTime;
+
+	const int32 acceptedCount = FMath::Clamp(FMath::FloorToInt32(AcceptedStartAllowance), 0, RequestedCount);
+	AcceptedStartAllowance -= acceptedCount;
+
+	return acceptedCount;
+}
+
+void UActorInteractorComponentBase::StartInteractionBatch_Server_Implementation(const uint8 Count, const float TimeSpan, const float ViewTime)
+{
+	SetClientViewTime(ViewTime);
+
+	if (Count == 0 || !GetWorld())
+		return;
+
+	if (!Execute_CanInteract(this) || !ActiveInteractable.GetInterface())
+		return;
+
+	// Batch is placed on Server timeline ending now, Span cannot exceed Batch Window
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const float maxTimeSpan = interactionSettings ? interactionSettings->GetInteractionStartBatchWindow() : 0.f;
+	const float lastTime = GetWorld()->GetTimeSeconds();
+	const float firstTime = lastTime - FMath::Clamp(TimeSpan, 0.f, maxTimeSpan);
+
+	// Count is Client data, accept only as many starts as plausible press rate allows since previous start
+	const int32 acceptedCount = ConsumeStartAllowance(Count);
+	if (acceptedCount <= 0)
+	{
+		LOG_WARNING(TEXT("[StartInteractionBatch] %s dropped %d Interaction starts above Max Interaction Start Rate"), *GetName(), Count)
+		return;
+	}
+
+	if (acceptedCount < Count)
+	{
+		LOG_WARNING(TEXT("[StartInteractionBatch] %s accepted %d of %d Interaction starts"), *GetName(), acceptedCount, Count)
+	}
+
+	INC_DWORD_STAT_BY(STAT_MounteaInteraction_BatchedStarts, acceptedCount);
+
+	Execute_SetState(this, EInteractorStateV2::EIS_Active);
+	ActiveInteractable->NotifyInteractionStartsBatched(acceptedCount, firstTime, lastTime, this);
+}
+
+void UActorInteractorComponentBase::BatchInteractionStart(const float StartTime)
+{
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const float batchWindow = interactionSettings ? interactionSettings->GetInteractionStartBatchWindow() : 0.f;
+
+	if (batchWindow <= 0.f || !GetWorld())
+	{
+		StartInteraction_Server(StartTime, GetClientViewTime());
+		return;
+	}
+
+	if (BatchedStartCount == 0)
+	{
+		BatchedStartFirstTime = StartTime;
+		GetWorld()->GetTimerManager().SetTimer(Timer_InteractionStartBatch, this, &UActorInteractorComponentBase::FlushInteractionStarts, batchWindow, false);
+	}
+
+	BatchedStartCount++;
+	BatchedStartLastTime = StartTime;
+
+	if (BatchedStartCount == MAX_uint8)
+	{
+		FlushInteractionStarts();
+	}
+}
+
+void UActorInteractorComponentBase::FlushInteractionStarts()
+{
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(Timer_InteractionStartBatch);
+	}
+
+	if (BatchedStartCount == 0)
+		return;
+
+	StartInteractionBatch_Server(BatchedStartCount, BatchedStartLastTime - BatchedStartFirstTime, GetClientViewTime());
+	BatchedStartCount = 0;
+}
+
+float UActorInteractorComponentBase::GetClientViewTime() const
+{
+	const UWorld* world = GetWorld();
+	if (!world)
+		return 0.f;
+
+	const AGameStateBase* gameState = world->GetGameState();
+	float viewTime = gameState ? gameState->GetServerWorldTimeSeconds() : world->GetTimeSeconds();
+
+	const APlayerState* playerState = nullptr;
+	if (const APawn* owningPawn = Cast<APawn>(GetOwner()))
+	{
+		playerState = owningPawn->GetPlayerState();
+	}
+	else if (const AController* owningController = Cast<AController>(GetOwner()))
+	{
+		playerState = owningController->PlayerState;
+	}
+
+	if (playerState)
+	{
+		viewTime -= playerState->GetPingInMilliseconds() * 0.0005f;
+	}
+
+	return viewTime;
+}
+
+void UActorInteractorComponentBase::SetClientViewTime(const float ViewTime)
+{
+	const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+	const float maxRewindTime = interactionSettings ? interactionSettings->GetLagCompensationMaxRewindTime() : 0.f;
+
+	if (!GetWorld() || maxRewindTime <= 0.f)
+	{
+		ClientViewLatency = -1.f;
+		return;
+	}
+
+	// Clients cannot reach further back than Lag Compensation window
+	ClientViewLatency = FMath::Clamp(GetWorld()->GetTimeSeconds() - ViewTime, 0.f, maxRewindTime);
+}
+
+float UActorInteractorComponentBase::GetValidationTime() const
+{
+	if (ClientViewLatency < 0.f || !GetWorld() || !GetOwner() || !GetOwner()->HasAuthority())
+		return -1.f;
+
+	return GetWorld()->GetTimeSeconds() - ClientViewLatency;
+}
+
+FTransform UActorInteractorComponentBase::GetValidationTransform(const AActor* InteractableActor) const
+{
+	if (!InteractableActor)
+		return FTransform::Identity;
+
+	const float validationTime = GetValidationTime();
+	if (validationTime >= 0.f)
+	{
+		for (const UActorComponent* interactableComponent : InteractableActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass()))
+		{
+			const IActorInteractableInterface* interactableInterface = Cast<IActorInteractableInterface>(interactableComponent);
+
+			FTransform rewoundTransform;
+			if (interactableInterface && interactableInterface->GetRewoundTransform(validationTime, rewoundTransform))
+			{
+				return rewoundTransform;
+			}
+		}
+	}
+
+	return InteractableActor->GetActorTransform();
+}
+
 void UActorInteractorComponentBase::SetState_Server_Implementation(const EInteractorStateV2 NewState)
 {
+	if (!MounteaInteractionStateMachine::InteractorStateTable.IsValidState(NewState))
+	{
+		LOG_WARNING(TEXT("[SetState_Server] Rejected invalid State %d"), static_cast<int32>(NewState))
+		return;
+	}
+	
 	Execute_SetState(this, NewState);
 }
 
@@ -4,10 +4,13 @@
 #include "Components/Interactor/ActorInteractorComponentOverlap.h"
 
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/MounteaInteractableProviderSubsystem.h"
+#include "Helpers/MounteaInteractionStats.h"
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Interfaces/ActorInteractableInterface.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "TimerManager.h"
 
 UActorInteractorComponentOverlap::UActorInteractorComponentOverlap()
 		: OverrideCollisionComponents(TArray<FName>()),
@@ -21,6 +24,24 @@ void UActorInteractorComponentOverlap::BeginPlay()
 {
 	SetupInteractorOverlap();
 	Super::BeginPlay();
+
+	// Overlaps are event driven, Interactables without Components have to be promoted before they can be overlapped
+	if (GetOwner() && GetOwner()->HasAuthority() && PromotionInterval > 0.f && UMounteaInteractableProviderSubsystem::HasProviders(GetWorld()))
+	{
+		GetWorld()->GetTimerManager().SetTimer(Timer_Promotion, this, &UActorInteractorComponentOverlap::RequestPromotion, PromotionInterval, true);
+	}
+}
+
+void UActorInteractorComponentOverlap::RequestPromotion()
+{
+	for (const UPrimitiveComponent* Itr : CollisionShapes)
+	{
+		if (!Itr)
+			continue;
+
+		const FBoxSphereBounds& shapeBounds = Itr->Bounds;
+		UMounteaInteractableProviderSubsystem::RequestPromotion(GetWorld(), shapeBounds.Origin, shapeBounds.Origin, shapeBounds.SphereRadius, this);
+	}
 }
 
 FString UActorInteractorComponentOverlap::ToString_Implementation() const
@@ -49,11 +70,6 @@ void UActorInteractorComponentOverlap::ProcessStateChanged()
 	}	
 }
 
-void UActorInteractorComponentOverlap::ProcessOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent,AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& SweepResult, const bool bOverlapStarted)
-{
-	ProcessOverlap(OverlappedComponent, OtherActor, OtherComp, SweepResult, bOverlapStarted);
-}
-
 void UActorInteractorComponentOverlap::SetupInteractorOverlap()
 {
 	for (auto Itr : OverrideCollisionComponents)
@@ -91,8 +107,12 @@ void UActorInteractorComponentOverlap::BindCollision(UPrimitiveComponent* Compon
 	Component->SetGenerateOverlapEvents(true);
 	Component->SetCollisionResponseToChannel(CollisionChannel, ECollisionResponse::ECR_Overlap);
 
-	Component->OnComponentBeginOverlap.		AddUniqueDynamic(this, &UActorInteractorComponentOverlap::StartInteractorOverlap);
-	Component->OnComponentEndOverlap.		AddUniqueDynamic(this, &UActorInteractorComponentOverlap::StopInteractorOverlap);
+	// Clients are presented Server result through Active Interactable and Interactable presentation, their overlaps are not needed
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		Component->OnComponentBeginOverlap.		AddUniqueDynamic(this, &UActorInteractorComponentOverlap::StartInteractorOverlap);
+		Component->OnComponentEndOverlap.		AddUniqueDynamic(this, &UActorInteractorComponentOverlap::StopInteractorOverlap);
+	}
 
 	switch (Component->GetCollisionEnabled())
 	{
@@ -122,6 +142,8 @@ void UActorInteractorComponentOverlap::UnbindCollisions()
 	{
 		UnbindCollision(Itr);
 	}
+
+	ClearCandidates();
 }
 
 void UActorInteractorComponentOverlap::UnbindCollision(UPrimitiveComponent* Component)
@@ -153,37 +175,39 @@ void UActorInteractorComponentOverlap::ProcessOverlap_Implementation(UPrimitiveC
 		return;
 	}
 
-	if (GetOwner()->HasAuthority())
+	// Server receives the same overlap from its own physics
+	if (!GetOwner()->HasAuthority())
 	{
-		if (!Execute_CanInteract(this))
-		{
-			return;
-		}
-		
-		if (!OtherActor)
-		{
+		return;
+	}
+
+	if (!Execute_CanInteract(this))
+	{
+		return;
+	}
+	
+	if (!OtherActor)
+	{
+		return;
+	}
+
+	if (!OtherActor->Implements<UActorInteractableInterface>())
+	{
+		auto interactableComponents = OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
+		if (interactableComponents.Num() == 0)
 			return;
-		}
+	}
 
-		if (!OtherActor->Implements<UActorInteractableInterface>())
-		{
-			auto interactableComponents = OtherActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass());
-			if (interactableComponents.Num() == 0)
-				return;
-		}
+	// Overlap happened in Server frame, nothing to rewind
+	TGuardValue<float> viewLatencyGuard(ClientViewLatency, -1.f);
 
-		if (bOverlapStarted)
-		{
-			HandleStartOverlap(OverlappedComponent, OtherActor, OtherComp, SweepResult);
-		}
-		else
-		{
-			HandleEndOverlap(OverlappedComponent, OtherActor, OtherComp);
-		}
+	if (bOverlapStarted)
+	{
+		HandleStartOverlap(OverlappedComponent, OtherActor, OtherComp, SweepResult);
 	}
 	else
 	{
-		ProcessOverlap_Server(OverlappedComponent, OtherActor, OtherComp, SweepResult, bOverlapStarted);
+		HandleEndOverlap(OverlappedComponent, OtherActor, OtherComp);
 	}
 }
 
@@ -199,10 +223,6 @@ void UActorInteractorComponentOverlap::StartInteractorOverlap(UPrimitiveComponen
 	{
 		ProcessOverlap(OverlappedComponent, OtherActor, OtherComp, SweepResult, true);
 	}
-	else
-	{
-		StartInteractorOverlap_Server(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
-	}
 }
 
 void UActorInteractorComponentOverlap::StopInteractorOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
@@ -217,14 +237,12 @@ void UActorInteractorComponentOverlap::StopInteractorOverlap(UPrimitiveComponent
 	{
 		ProcessOverlap(OverlappedComponent, OtherActor, OtherComp, FHitResult(), false);
 	}
-	else
-	{
-		StopInteractorOverlap_Server(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
-	}
 }
 
 void UActorInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& HitResult)
 {
+	MOUNTEA_INTERACTION_SCOPE(HandleStartOverlap, STAT_MounteaInteraction_HandleStartOverlap);
+
 	if (!OtherActor)
 	{
 		LOG_ERROR(TEXT("[HandleStartOverlap] OtherActor is null!"));
@@ -253,9 +271,6 @@ void UActorInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent* P
 	{
 		TScriptInterface<IActorInteractableInterface> InteractableComponent = TScriptInterface<IActorInteractableInterface>(Component);
 
-		if (!InteractableComponent->Execute_CanBeTriggered(Component))
-			continue;
-
 		ECollisionChannel componentCollisionChannel = InteractableComponent->Execute_GetCollisionChannel(Component);
 		if (componentCollisionChannel != Execute_GetResponseChannel(this))
 			continue;
@@ -263,7 +278,12 @@ void UActorInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent* P
 		if (PrimitiveComponent->GetCollisionResponseToChannel(componentCollisionChannel) == ECR_Ignore)
 			continue;
 
-		if (!InteractableComponent->Execute_CanBeTriggered(InteractableComponent.GetObject()))
+		if (InteractableComponent->IsInteractorClassIgnored(GetClass()))
+			continue;
+
+		AddCandidate(InteractableComponent, OtherActor);
+
+		if (!InteractableComponent->CanBeTriggeredNative())
 			continue;
 
 		int32 ComponentWeight = InteractableComponent->Execute_GetInteractableWeight(Component);
@@ -301,12 +321,14 @@ void UActorInteractorComponentOverlap::HandleStartOverlap(UPrimitiveComponent* P
 	OnInteractableLost.Broadcast(currentlyActiveInteractable);
 	OnInteractableFound.Broadcast(tempInteractable);
 
-	tempInteractable->GetOnInteractorOverlappedHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0, false, HitResult);
-	tempInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+	tempInteractable->NotifyInteractorOverlapped(PrimitiveComponent, OtherActor, OtherComp, 0, false, HitResult);
+	tempInteractable->NotifyInteractorFound(this);
 }
 
 void UActorInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp)
 {
+	MOUNTEA_INTERACTION_SCOPE(HandleEndOverlap, STAT_MounteaInteraction_HandleEndOverlap);
+
 	if (!OtherActor)
 	{
 		LOG_ERROR(TEXT("[HandleEndOverlap] OtherActor is null!"));
@@ -325,6 +347,8 @@ void UActorInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* Pri
 		return;
 	}
 
+	RemoveCandidates(OtherActor);
+
 	TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable = Execute_GetActiveInteractable(this);
 	if (!currentlyActiveInteractable.GetObject())
 	{
@@ -349,46 +373,259 @@ void UActorInteractorComponentOverlap::HandleEndOverlap(UPrimitiveComponent* Pri
 	}
 
 	// Check if we still overlap at least one of the collision components from the active interactable
-	bool bStillOverlapping = false;
-	const TArray<UPrimitiveComponent*> interactableCollisionComponents = currentlyActiveInteractable->Execute_GetCollisionComponents(currentlyActiveInteractable.GetObject());
+	UPrimitiveComponent* interactorComponent = nullptr;
+	UPrimitiveComponent* interactableComponent = nullptr;
+	if (FindOverlappingComponents(currentlyActiveInteractable, interactorComponent, interactableComponent))
+	{
+		return;
+	}
+	
+	OnInteractableLost.Broadcast(currentlyActiveInteractable);
+	
+	currentlyActiveInteractable->NotifyInteractorStopOverlap(PrimitiveComponent, OtherActor, OtherComp, 0);
+	currentlyActiveInteractable->NotifyInteractorLost(this);
+
+	PromoteCandidate();
+}
+
+bool UActorInteractorComponentOverlap::FindOverlappingComponents(const TScriptInterface<IActorInteractableInterface>& Interactable, UPrimitiveComponent*& OutInteractorComponent, UPrimitiveComponent*& OutInteractableComponent) const
+{
+	OutInteractorComponent = nullptr;
+	OutInteractableComponent = nullptr;
+
+	if (!Interactable.GetObject())
+	{
+		return false;
+	}
+	
+	const TArray<UPrimitiveComponent*> interactableCollisionComponents = Interactable->Execute_GetCollisionComponents(Interactable.GetObject());
 	for (UPrimitiveComponent* InteractableComp : interactableCollisionComponents)
 	{
-		if (!InteractableComp->IsOverlappingActor(GetOwner()))
+		if (!InteractableComp || !InteractableComp->IsOverlappingActor(GetOwner()))
 			continue;
 		
 		for (UPrimitiveComponent* InteractorComp : CollisionShapes)
 		{
-			if (InteractableComp && InteractorComp && InteractableComp->IsOverlappingComponent(InteractorComp))
+			if (InteractorComp && InteractableComp->IsOverlappingComponent(InteractorComp))
 			{
-				bStillOverlapping = true;
-				break;
+				OutInteractorComponent = InteractorComp;
+				OutInteractableComponent = InteractableComp;
+				return true;
 			}
 		}
-		if (bStillOverlapping)
+	}
+
+	return false;
+}
+
+void UActorInteractorComponentOverlap::AddCandidate(const TScriptInterface<IActorInteractableInterface>& Interactable, AActor* OwningActor)
+{
+	UObject* interactableObject = Interactable.GetObject();
+	if (!interactableObject)
+	{
+		return;
+	}
+
+	FOverlapInteractableCandidate newCandidate;
+	newCandidate.Interactable = interactableObject;
+	newCandidate.OwningActor = OwningActor;
+	newCandidate.Weight = Interactable->Execute_GetInteractableWeight(interactableObject);
+
+	if (CandidateHeap.Contains(newCandidate) || DormantCandidates.Contains(newCandidate))
+	{
+		return;
+	}
+
+	Interactable->GetInteractableWeightChanged().	AddUniqueDynamic(this, &UActorInteractorComponentOverlap::OnCandidateWeightChanged);
+	Interactable->GetInteractableStateChanged().		AddUniqueDynamic(this, &UActorInteractorComponentOverlap::OnCandidateStateChanged);
+
+	if (Interactable->CanBeTriggeredNative())
+	{
+		CandidateHeap.HeapPush(newCandidate, FOverlapInteractableCandidatePredicate());
+	}
+	else
+	{
+		DormantCandidates.Add(newCandidate);
+	}
+}
+
+void UActorInteractorComponentOverlap::RemoveCandidates(const AActor* OwningActor)
+{
+	auto shouldRemove = [this, OwningActor](const FOverlapInteractableCandidate& Candidate)
+	{
+		UObject* interactableObject = Candidate.Interactable.Get();
+		if (!interactableObject)
+		{
+			return true;
+		}
+
+		if (Candidate.OwningActor.Get() != OwningActor)
 		{
-			break;
+			return false;
+		}
+
+		const TScriptInterface<IActorInteractableInterface> interactable(interactableObject);
+		UPrimitiveComponent* interactorComponent = nullptr;
+		UPrimitiveComponent* interactableComponent = nullptr;
+		if (FindOverlappingComponents(interactable, interactorComponent, interactableComponent))
+		{
+			return false;
+		}
+
+		interactable->GetInteractableWeightChanged().	RemoveDynamic(this, &UActorInteractorComponentOverlap::OnCandidateWeightChanged);
+		interactable->GetInteractableStateChanged().		RemoveDynamic(this, &UActorInteractorComponentOverlap::OnCandidateStateChanged);
+		return true;
+	};
+
+	const int32 removedCount = CandidateHeap.RemoveAll(shouldRemove);
+	DormantCandidates.RemoveAll(shouldRemove);
+
+	if (removedCount > 0)
+	{
+		CandidateHeap.Heapify(FOverlapInteractableCandidatePredicate());
+	}
+}
+
+void UActorInteractorComponentOverlap::ClearCandidates()
+{
+	auto unbindCandidate = [this](const FOverlapInteractableCandidate& Candidate)
+	{
+		if (UObject* interactableObject = Candidate.Interactable.Get())
+		{
+			const TScriptInterface<IActorInteractableInterface> interactable(interactableObject);
+			interactable->GetInteractableWeightChanged().	RemoveDynamic(this, &UActorInteractorComponentOverlap::OnCandidateWeightChanged);
+			interactable->GetInteractableStateChanged().		RemoveDynamic(this, &UActorInteractorComponentOverlap::OnCandidateStateChanged);
 		}
+	};
+
+	for (const auto& Itr : CandidateHeap)
+	{
+		unbindCandidate(Itr);
 	}
 
-	if (bStillOverlapping)
+	for (const auto& Itr : DormantCandidates)
 	{
-		return;
+		unbindCandidate(Itr);
 	}
+
+	CandidateHeap.Empty();
+	DormantCandidates.Empty();
+}
+
+void UActorInteractorComponentOverlap::RefreshCandidates()
+{
+	TArray<FOverlapInteractableCandidate> allCandidates = MoveTemp(CandidateHeap);
+	allCandidates.Append(MoveTemp(DormantCandidates));
+
+	CandidateHeap.Reset();
+	DormantCandidates.Reset();
+
+	for (auto& Itr : allCandidates)
+	{
+		UObject* interactableObject = Itr.Interactable.Get();
+		if (!interactableObject)
+			continue;
+
+		const TScriptInterface<IActorInteractableInterface> interactable(interactableObject);
+		Itr.Weight = interactable->Execute_GetInteractableWeight(interactableObject);
+
+		if (interactable->CanBeTriggeredNative())
+		{
+			CandidateHeap.Add(Itr);
+		}
+		else
+		{
+			DormantCandidates.Add(Itr);
+		}
+	}
+
+	CandidateHeap.Heapify(FOverlapInteractableCandidatePredicate());
+}
+
+bool UActorInteractorComponentOverlap::PromoteCandidate()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return false;
+	}
+
+	if (!Execute_CanInteract(this))
+	{
+		return false;
+	}
+
+	const TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable = Execute_GetActiveInteractable(this);
+	if (currentlyActiveInteractable.GetObject())
+	{
+		return false;
+	}
+
+	// Candidates which cannot be promoted right now (blocked by safety trace) are pushed back once done
+	TArray<FOverlapInteractableCandidate> skippedCandidates;
+	bool bPromoted = false;
 	
-	OnInteractableLost.Broadcast(currentlyActiveInteractable);
-	
-	currentlyActiveInteractable->GetOnInteractorStopOverlapHandle().Broadcast(PrimitiveComponent, OtherActor, OtherComp, 0);
-	currentlyActiveInteractable->GetOnInteractorLostHandle().Broadcast(this);
+	while (CandidateHeap.Num() > 0)
+	{
+		FOverlapInteractableCandidate topCandidate;
+		CandidateHeap.HeapPop(topCandidate, FOverlapInteractableCandidatePredicate(), EAllowShrinking::No);
+
+		UObject* interactableObject = topCandidate.Interactable.Get();
+		AActor* owningActor = topCandidate.OwningActor.Get();
+		if (!interactableObject || !owningActor)
+			continue;
+
+		const TScriptInterface<IActorInteractableInterface> candidateInteractable(interactableObject);
+		if (!candidateInteractable->CanBeTriggeredNative())
+		{
+			DormantCandidates.Add(topCandidate);
+			continue;
+		}
+
+		UPrimitiveComponent* interactorComponent = nullptr;
+		UPrimitiveComponent* interactableComponent = nullptr;
+		if (!FindOverlappingComponents(candidateInteractable, interactorComponent, interactableComponent) || !Execute_PerformSafetyTrace(this, owningActor))
+		{
+			skippedCandidates.Add(topCandidate);
+			continue;
+		}
+
+		skippedCandidates.Add(topCandidate);
+		
+		OnInteractableFound.Broadcast(candidateInteractable);
+
+		candidateInteractable->NotifyInteractorOverlapped(interactorComponent, owningActor, interactableComponent, 0, false, FHitResult());
+		candidateInteractable->NotifyInteractorFound(this);
+
+		bPromoted = true;
+		break;
+	}
+
+	for (const auto& Itr : skippedCandidates)
+	{
+		CandidateHeap.HeapPush(Itr, FOverlapInteractableCandidatePredicate());
+	}
+
+	return bPromoted;
 }
 
-void UActorInteractorComponentOverlap::StartInteractorOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void UActorInteractorComponentOverlap::OnCandidateWeightChanged(const int32& NewWeight)
 {
-	StartInteractorOverlap(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+	RefreshCandidates();
+
+	if (!Execute_GetActiveInteractable(this).GetObject())
+	{
+		PromoteCandidate();
+	}
 }
 
-void UActorInteractorComponentOverlap::StopInteractorOverlap_Server_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void UActorInteractorComponentOverlap::OnCandidateStateChanged(const EInteractableStateV2& NewState)
 {
-	StopInteractorOverlap(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
+	RefreshCandidates();
+
+	if (!Execute_GetActiveInteractable(this).GetObject())
+	{
+		PromoteCandidate();
+	}
 }
 
 void UActorInteractorComponentOverlap::AddCollisionComponent_Implementation(UPrimitiveComponent* CollisionComponent)
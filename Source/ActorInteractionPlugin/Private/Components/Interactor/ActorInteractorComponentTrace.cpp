@@ -8,12 +8,19 @@
 #include "Kismet/KismetMathLibrary.h"
 
 #include "GameFramework/Actor.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Math/VectorRegister.h"
 
 #include "TimerManager.h"
+#include "Helpers/ActorInteractionFunctionLibrary.h"
 #include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/MounteaInteractableProviderSubsystem.h"
+#include "Helpers/MounteaInteractionStats.h"
 
 #include "Net/UnrealNetwork.h"
 
@@ -27,7 +34,16 @@ UActorInteractorComponentTrace::UActorInteractorComponentTrace() :
 		TraceInterval(0.1f),
 		TraceRange(250.f),
 		TraceShapeHalfSize(5.f),
-		bUseCustomStartTransform(false)
+		bUseCustomStartTransform(false),
+		ConeHalfAngle(15.f),
+		ConeAngleScale(1.f),
+		ConeDistanceScale(0.5f),
+		ConeWeightScale(0.1f),
+		bUseTemporalCoherence(false),
+		CoherenceLinearThreshold(1.f),
+		CoherenceAngularThreshold(0.5f),
+		bVerifyActiveInteractable(true),
+		MaxSkippedTraces(10)
 {
 	ComponentTags.Add(FName("Trace"));
 	
@@ -158,6 +174,8 @@ void UActorInteractorComponentTrace::ResumeTracing_Implementation()
 
 void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 {
+	MOUNTEA_INTERACTION_SCOPE(ProcessTrace, STAT_MounteaInteraction_ProcessTrace);
+
 	if (!GetOwner())
 	{
 		LOG_ERROR(TEXT("[ProcessTrace] No Owner!"));
@@ -166,7 +184,7 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 
 	if (!GetOwner()->HasAuthority())
 	{
-		ProcessTrace_Server();
+		ProcessTrace_Server(GetClientViewTime());
 		return;
 	}
 	
@@ -181,6 +199,9 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 	FInteractionTraceDataV2 TraceData;
 	{
 		TraceData.CollisionChannel = Execute_GetResponseChannel(this);
+		
+		const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+		TraceData.ObjectType = interactionSettings ? interactionSettings->GetInteractableObjectType() : ECC_MAX;
 		TraceData.CollisionParams.AddIgnoredActors(ListOfIgnoredActors);
 		TraceData.CollisionParams.MobilityType = EQueryMobilityType::Any;
 		TraceData.CollisionParams.bReturnPhysicalMaterial = true;
@@ -208,6 +229,33 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 		}
 #endif
 
+	ProcessedTracesCount++;
+	
+	if (CanSkipTrace(TraceData))
+	{
+		SkippedTracesCount++;
+		INC_DWORD_STAT(STAT_MounteaInteraction_TracesSkipped);
+
+		PostTraced_Client();
+		PostTraced();
+
+		ResumeTracing();
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_MounteaInteraction_TracesFull);
+
+	// Interactables which are not backed by Components yet, e.g. Mass Entities, become traceable
+	if (TraceType == ETraceType::ETT_Cone)
+	{
+		UMounteaInteractableProviderSubsystem::RequestPromotion(GetWorld(), TraceData.StartLocation, TraceData.StartLocation, TraceRange, this);
+	}
+	else
+	{
+		const float promotionRadius = TraceType == ETraceType::ETT_Loose ? TraceShapeHalfSize : 0.f;
+		UMounteaInteractableProviderSubsystem::RequestPromotion(GetWorld(), TraceData.StartLocation, TraceData.EndLocation, promotionRadius, this);
+	}
+
 	switch (TraceType)
 	{
 		case ETraceType::ETT_Precise:
@@ -216,6 +264,9 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 		case ETraceType::ETT_Loose:
 			ProcessTrace_Loose(TraceData);
 			break;
+		case ETraceType::ETT_Cone:
+			ProcessTrace_Cone(TraceData);
+			break;
 		case ETraceType::Default:
 		default:
 			break;
@@ -226,6 +277,10 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 
 	FHitResult BestHitResult;
 	TScriptInterface<IActorInteractableInterface> bestFoundInteractable = nullptr;
+	const TScriptInterface<IActorInteractableInterface> currentlyActiveInteractable = Execute_GetActiveInteractable(this);
+	
+	// Cone Trace returns hits already ranked by score, first valid hit wins
+	const bool bRankedHits = TraceType == ETraceType::ETT_Cone;
 
 	for (FHitResult& HitResult : TraceData.HitResults)
 	{
@@ -249,19 +304,27 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 			if (!localInteractable.GetObject() || !localInteractable.GetInterface())
 				continue;
 
+			INC_DWORD_STAT(STAT_MounteaInteraction_HitsEvaluated);
+
 			if (!localInteractable->Execute_GetCollisionComponents(Itr).Contains(HitResult.GetComponent()))
 				continue;
 
+			if (!localInteractable->CanBeTriggeredByHit(HitResult, this))
+				continue;
+
 			if (localInteractable->Execute_GetCollisionChannel(Itr) != Execute_GetResponseChannel(this))
 				continue;
 
-			if (!localInteractable->Execute_CanBeTriggered(Itr))
+			if (localInteractable->IsInteractorClassIgnored(GetClass()))
+				continue;
+
+			if (!localInteractable->CanBeTriggeredNative())
 			{
 				if (localInteractable->Execute_GetInteractor(Itr) != this)
 					continue;
 			}
 
-			if (InteractorTag.IsValid() && !localInteractable->Execute_GetInteractableCompatibleTags(Itr).HasTag(InteractorTag))
+			if (InteractorTag.IsValid() && !localInteractable->IsCompatibleWithTag(InteractorTag, GetInteractorTagBit()))
 			{
 				LOG_INFO(TEXT("[ProcessTrace] Interactor Tag %s is not compatible with %s Interactable on %s Actor"), *InteractorTag.ToString(), *localInteractable->Execute_GetInteractableName(Itr).ToString(), *HitActor->GetName())
 				continue;
@@ -269,7 +332,8 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 
 			bAnyInteractable = true;
 
-			if (localInteractable == Execute_GetActiveInteractable(this))
+			const bool bIsActiveInteractable = localInteractable == currentlyActiveInteractable;
+			if (bIsActiveInteractable)
 			{
 				bFoundActiveAgain = true;
 			}
@@ -277,7 +341,13 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 			const float localInteractableWeight = localInteractable->Execute_GetInteractableWeight(Itr);
 			const float bestFoundInteractableWeight = bestFoundInteractable != nullptr ? bestFoundInteractable->Execute_GetInteractableWeight(bestFoundInteractable.GetObject()) : -1.f;
 
-			if (bestFoundInteractable == nullptr || localInteractableWeight > bestFoundInteractableWeight)
+			// Hysteresis: with equal Weights keep the Active Interactable instead of flickering between candidates
+			const bool bPreferActive = bIsActiveInteractable && bestFoundInteractable != localInteractable && FMath::IsNearlyEqual(localInteractableWeight, bestFoundInteractableWeight);
+
+			if (bRankedHits && bestFoundInteractable != nullptr && (BestHitResult.GetComponent() != HitResult.GetComponent() || BestHitResult.Item != HitResult.Item))
+				continue;
+
+			if (bestFoundInteractable == nullptr || localInteractableWeight > bestFoundInteractableWeight || bPreferActive)
 			{
 				if (!Execute_PerformSafetyTrace(this, HitActor))
 				{
@@ -291,6 +361,24 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 		}
 	}
 
+	// Moving Active Interactable may be hit only where the Client has seen it
+	if (!bFoundActiveAgain && currentlyActiveInteractable.GetObject() && GetValidationTime() >= 0.f)
+	{
+		const float activeWeight = currentlyActiveInteractable->Execute_GetInteractableWeight(currentlyActiveInteractable.GetObject());
+		const bool bOutweighed = bestFoundInteractable != nullptr && bestFoundInteractable->Execute_GetInteractableWeight(bestFoundInteractable.GetObject()) > activeWeight;
+
+		if (!bOutweighed && ValidateRewoundInteractable(currentlyActiveInteractable, TraceData))
+		{
+			bestFoundInteractable = currentlyActiveInteractable;
+			bAnyInteractable = true;
+		}
+	}
+
+	if (bestFoundInteractable != nullptr)
+	{
+		bestFoundInteractable->NotifyHitTargeted(BestHitResult, this);
+	}
+
 	if (bestFoundInteractable != Execute_GetActiveInteractable(this))
 	{
 		if (Execute_GetActiveInteractable(this) != nullptr)
@@ -304,8 +392,8 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 		if (bAnyInteractable && Execute_GetActiveInteractable(this) != bestFoundInteractable)
 		{
 			OnInteractableFound.Broadcast(bestFoundInteractable);
-			bestFoundInteractable->GetOnInteractorTracedHandle().Broadcast(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
-			bestFoundInteractable->GetOnInteractorFoundHandle().Broadcast(this);
+			bestFoundInteractable->NotifyInteractorTraced(BestHitResult.GetComponent(), GetOwner(), nullptr, BestHitResult.Location, BestHitResult);
+			bestFoundInteractable->NotifyInteractorFound(this);
 		}
 	}
 
@@ -316,6 +404,9 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 	}
 #endif
 
+	UpdateTraceCoherence(TraceData);
+	TraceCoherence.HitItem = BestHitResult.Item;
+
 	// Update Client
 	PostTraced_Client();
 	PostTraced();
@@ -325,6 +416,22 @@ void UActorInteractorComponentTrace::ProcessTrace_Implementation()
 
 void UActorInteractorComponentTrace::ProcessTrace_Precise(FInteractionTraceDataV2& InteractionTraceData)
 {
+	MOUNTEA_INTERACTION_SCOPE(ProcessTrace_Precise, STAT_MounteaInteraction_TraceQuery);
+
+	// Only bound Interactable Collision Shapes are returned, obstacles are left to Safety Trace
+	if (InteractionTraceData.ObjectType != ECC_MAX)
+	{
+		GetWorld()->LineTraceMultiByObjectType
+		(
+			InteractionTraceData.HitResults,
+			InteractionTraceData.StartLocation,
+			InteractionTraceData.EndLocation,
+			FCollisionObjectQueryParams(InteractionTraceData.ObjectType),
+			InteractionTraceData.CollisionParams
+		);
+		return;
+	}
+
 	GetWorld()->LineTraceMultiByChannel
 	(
 		InteractionTraceData.HitResults,
@@ -337,8 +444,25 @@ void UActorInteractorComponentTrace::ProcessTrace_Precise(FInteractionTraceDataV
 
 void UActorInteractorComponentTrace::ProcessTrace_Loose(FInteractionTraceDataV2& InteractionTraceData)
 {
+	MOUNTEA_INTERACTION_SCOPE(ProcessTrace_Loose, STAT_MounteaInteraction_TraceQuery);
+
 	const FCollisionShape CollisionShape = FCollisionShape::MakeBox(FVector(TraceShapeHalfSize));
 
+	if (InteractionTraceData.ObjectType != ECC_MAX)
+	{
+		GetWorld()->SweepMultiByObjectType
+		(
+			InteractionTraceData.HitResults,
+			InteractionTraceData.StartLocation,
+			InteractionTraceData.EndLocation,
+			InteractionTraceData.TraceRotation.Quaternion(),
+			FCollisionObjectQueryParams(InteractionTraceData.ObjectType),
+			CollisionShape,
+			InteractionTraceData.CollisionParams
+		);
+		return;
+	}
+
 	GetWorld()->SweepMultiByChannel
 	(
 		InteractionTraceData.HitResults,
@@ -351,6 +475,308 @@ void UActorInteractorComponentTrace::ProcessTrace_Loose(FInteractionTraceDataV2&
 	);
 }
 
+void UActorInteractorComponentTrace::ProcessTrace_Cone(FInteractionTraceDataV2& InteractionTraceData)
+{
+	MOUNTEA_INTERACTION_SCOPE(ProcessTrace_Cone, STAT_MounteaInteraction_TraceQuery);
+
+	TArray<FOverlapResult> overlapResults;
+	if (InteractionTraceData.ObjectType != ECC_MAX)
+	{
+		GetWorld()->OverlapMultiByObjectType
+		(
+			overlapResults,
+			InteractionTraceData.StartLocation,
+			FQuat::Identity,
+			FCollisionObjectQueryParams(InteractionTraceData.ObjectType),
+			FCollisionShape::MakeSphere(TraceRange),
+			InteractionTraceData.CollisionParams
+		);
+	}
+	else
+	{
+		GetWorld()->OverlapMultiByChannel
+		(
+			overlapResults,
+			InteractionTraceData.StartLocation,
+			FQuat::Identity,
+			InteractionTraceData.CollisionChannel,
+			FCollisionShape::MakeSphere(TraceRange),
+			InteractionTraceData.CollisionParams
+		);
+	}
+
+	ConeCandidates.Reset();
+
+	// Highest Weight of Interactables per Actor, so each Actor is queried only once
+	TMap<const AActor*, int32> actorWeights;
+	for (const FOverlapResult& Itr : overlapResults)
+	{
+		UPrimitiveComponent* overlapComponent = Itr.GetComponent();
+		const AActor* overlapActor = Itr.GetActor();
+		if (!overlapComponent || !overlapActor)
+			continue;
+
+		int32* actorWeight = actorWeights.Find(overlapActor);
+		if (!actorWeight)
+		{
+			int32 highestWeight = INDEX_NONE;
+			for (const auto& Component : overlapActor->GetComponentsByInterface(UActorInteractableInterface::StaticClass()))
+			{
+				highestWeight = FMath::Max(highestWeight, IActorInteractableInterface::Execute_GetInteractableWeight(Component));
+			}
+			actorWeight = &actorWeights.Add(overlapActor, highestWeight);
+		}
+
+		if (*actorWeight == INDEX_NONE)
+			continue;
+
+		// Instances of Instanced Static Mesh are ranked on their own
+		const UInstancedStaticMeshComponent* instancedComponent = Cast<UInstancedStaticMeshComponent>(overlapComponent);
+		FTransform instanceTransform;
+		if (instancedComponent && instancedComponent->GetInstanceTransform(Itr.ItemIndex, instanceTransform, true))
+		{
+			ConeCandidates.Add(overlapComponent, instanceTransform.GetLocation(), static_cast<float>(*actorWeight), Itr.ItemIndex);
+			continue;
+		}
+
+		ConeCandidates.Add(overlapComponent, overlapComponent->Bounds.Origin, static_cast<float>(*actorWeight));
+	}
+
+	if (ConeCandidates.Num() == 0)
+		return;
+
+	ScoreConeCandidates(ConeCandidates, InteractionTraceData);
+
+	TArray<int32> rankedCandidates;
+	rankedCandidates.Reserve(ConeCandidates.Num());
+	for (int32 i = 0; i < ConeCandidates.Num(); i++)
+	{
+		if (ConeCandidates.Score[i] > -UE_BIG_NUMBER)
+		{
+			rankedCandidates.Add(i);
+		}
+	}
+
+	rankedCandidates.Sort([this](const int32 A, const int32 B)
+	{
+		return ConeCandidates.Score[A] > ConeCandidates.Score[B];
+	});
+
+	InteractionTraceData.HitResults.Reserve(rankedCandidates.Num());
+	for (const int32 Index : rankedCandidates)
+	{
+		UPrimitiveComponent* candidateComponent = ConeCandidates.Components[Index].Get();
+		if (!candidateComponent)
+			continue;
+
+		const FVector candidateLocation(ConeCandidates.LocationX[Index], ConeCandidates.LocationY[Index], ConeCandidates.LocationZ[Index]);
+		const FVector candidateNormal = (InteractionTraceData.StartLocation - candidateLocation).GetSafeNormal();
+		
+		FHitResult& candidateHit = InteractionTraceData.HitResults.Emplace_GetRef(candidateComponent->GetOwner(), candidateComponent, candidateLocation, candidateNormal);
+		candidateHit.Item = ConeCandidates.Items[Index];
+	}
+}
+
+void UActorInteractorComponentTrace::ScoreConeCandidates(FInteractionConeCandidates& Candidates, const FInteractionTraceDataV2& InteractionTraceData) const
+{
+	MOUNTEA_INTERACTION_SCOPE(ScoreConeCandidates, STAT_MounteaInteraction_TraceQuery);
+
+	Candidates.Pad();
+	
+	const FVector traceDirection = InteractionTraceData.TraceRotation.Vector();
+
+	const VectorRegister4Float startX = VectorSetFloat1(InteractionTraceData.StartLocation.X);
+	const VectorRegister4Float startY = VectorSetFloat1(InteractionTraceData.StartLocation.Y);
+	const VectorRegister4Float startZ = VectorSetFloat1(InteractionTraceData.StartLocation.Z);
+	
+	const VectorRegister4Float directionX = VectorSetFloat1(traceDirection.X);
+	const VectorRegister4Float directionY = VectorSetFloat1(traceDirection.Y);
+	const VectorRegister4Float directionZ = VectorSetFloat1(traceDirection.Z);
+
+	const VectorRegister4Float cosHalfAngle = VectorSetFloat1(FMath::Cos(FMath::DegreesToRadians(ConeHalfAngle)));
+	const VectorRegister4Float rangeSquared = VectorSetFloat1(FMath::Square(TraceRange));
+	const VectorRegister4Float inverseRange = VectorSetFloat1(1.f / FMath::Max(1.f, TraceRange));
+	const VectorRegister4Float minDistanceSquared = VectorSetFloat1(UE_KINDA_SMALL_NUMBER);
+	const VectorRegister4Float rejectedScore = VectorSetFloat1(-UE_BIG_NUMBER);
+
+	const VectorRegister4Float angleScale = VectorSetFloat1(ConeAngleScale);
+	const VectorRegister4Float distanceScale = VectorSetFloat1(ConeDistanceScale);
+	const VectorRegister4Float weightScale = VectorSetFloat1(ConeWeightScale);
+
+	for (int32 i = 0; i < Candidates.Score.Num(); i += 4)
+	{
+		const VectorRegister4Float deltaX = VectorSubtract(VectorLoad(&Candidates.LocationX[i]), startX);
+		const VectorRegister4Float deltaY = VectorSubtract(VectorLoad(&Candidates.LocationY[i]), startY);
+		const VectorRegister4Float deltaZ = VectorSubtract(VectorLoad(&Candidates.LocationZ[i]), startZ);
+
+		const VectorRegister4Float distanceSquared = VectorMax(VectorMultiplyAdd(deltaX, deltaX, VectorMultiplyAdd(deltaY, deltaY, VectorMultiply(deltaZ, deltaZ))), minDistanceSquared);
+		const VectorRegister4Float projection = VectorMultiplyAdd(deltaX, directionX, VectorMultiplyAdd(deltaY, directionY, VectorMultiply(deltaZ, directionZ)));
+		const VectorRegister4Float inverseDistance = VectorReciprocalSqrt(distanceSquared);
+
+		// Cosine of angle between view axis and candidate, 1 means dead center
+		const VectorRegister4Float angleCos = VectorMultiply(projection, inverseDistance);
+		// Normalized closeness, 1 means at Trace Start, 0 means at Trace Range
+		const VectorRegister4Float closeness = VectorSubtract(GlobalVectorConstants::FloatOne, VectorMultiply(VectorMultiply(distanceSquared, inverseDistance), inverseRange));
+
+		VectorRegister4Float score = VectorMultiply(angleCos, angleScale);
+		score = VectorMultiplyAdd(closeness, distanceScale, score);
+		score = VectorMultiplyAdd(VectorLoad(&Candidates.Weight[i]), weightScale, score);
+
+		const VectorRegister4Float insideCone = VectorBitwiseAnd(VectorCompareGE(angleCos, cosHalfAngle), VectorCompareLE(distanceSquared, rangeSquared));
+		VectorStore(VectorSelect(insideCone, score, rejectedScore), &Candidates.Score[i]);
+	}
+}
+
+bool UActorInteractorComponentTrace::ValidateRewoundInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable, const FInteractionTraceDataV2& InteractionTraceData)
+{
+	MOUNTEA_INTERACTION_SCOPE(ValidateRewoundInteractable, STAT_MounteaInteraction_RewindValidation);
+
+	UObject* interactableObject = Interactable.GetObject();
+	const UActorComponent* interactableComponent = Cast<UActorComponent>(interactableObject);
+	const AActor* interactableActor = interactableComponent ? interactableComponent->GetOwner() : nullptr;
+	if (!interactableActor)
+		return false;
+
+	if (!Interactable->CanBeTriggeredNative() && Interactable->Execute_GetInteractor(interactableObject) != this)
+		return false;
+
+	const FTransform rewoundTransform = GetValidationTransform(interactableActor);
+	const FTransform& currentTransform = interactableActor->GetActorTransform();
+
+	// Nothing has been rewound, regular Trace result stands
+	if (rewoundTransform.Equals(currentTransform))
+		return false;
+
+	INC_DWORD_STAT(STAT_MounteaInteraction_RewoundValidations);
+
+	// Query points relative to the rewound Interactable, expressed in its current frame
+	auto toCurrentFrame = [&rewoundTransform, &currentTransform](const FVector& Location)
+	{
+		return currentTransform.TransformPosition(rewoundTransform.InverseTransformPosition(Location));
+	};
+
+	const FVector traceStart = toCurrentFrame(InteractionTraceData.StartLocation);
+	const FVector traceEnd = toCurrentFrame(InteractionTraceData.EndLocation);
+
+	bool bHit = false;
+	for (UPrimitiveComponent* collisionComponent : Interactable->Execute_GetCollisionComponents(interactableObject))
+	{
+		if (!collisionComponent)
+			continue;
+
+		FHitResult rewoundHit;
+		switch (TraceType)
+		{
+			case ETraceType::ETT_Precise:
+				bHit = collisionComponent->LineTraceComponent(rewoundHit, traceStart, traceEnd, InteractionTraceData.CollisionParams);
+				break;
+			case ETraceType::ETT_Loose:
+				bHit = collisionComponent->SweepComponent(rewoundHit, traceStart, traceEnd, FQuat::Identity, FCollisionShape::MakeBox(FVector(TraceShapeHalfSize)));
+				break;
+			case ETraceType::ETT_Cone:
+			{
+				const FVector toCandidate = toCurrentFrame(collisionComponent->Bounds.Origin) - InteractionTraceData.StartLocation;
+				const FVector traceDirection = InteractionTraceData.TraceRotation.Vector();
+				bHit = toCandidate.SizeSquared() <= FMath::Square(TraceRange)
+					&& FVector::DotProduct(toCandidate.GetSafeNormal(), traceDirection) >= FMath::Cos(FMath::DegreesToRadians(ConeHalfAngle));
+				break;
+			}
+			case ETraceType::Default:
+			default:
+				break;
+		}
+
+		if (bHit)
+			break;
+	}
+
+	return bHit && Execute_PerformSafetyTrace(this, interactableActor);
+}
+
+bool UActorInteractorComponentTrace::CanSkipTrace(const FInteractionTraceDataV2& InteractionTraceData)
+{
+	if (!bUseTemporalCoherence || !TraceCoherence.bIsValid)
+		return false;
+
+	if (TraceCoherence.SkippedTraces >= MaxSkippedTraces)
+		return false;
+
+	const TScriptInterface<IActorInteractableInterface> activeInteractable = Execute_GetActiveInteractable(this);
+	UObject* activeInteractableObject = activeInteractable.GetObject();
+	if (!activeInteractableObject || TraceCoherence.ActiveInteractable.Get() != activeInteractableObject)
+		return false;
+
+	if (TraceCoherence.TraceType != TraceType)
+		return false;
+
+	if (!FVector::PointsAreNear(TraceCoherence.StartLocation, InteractionTraceData.StartLocation, CoherenceLinearThreshold))
+		return false;
+
+	if (!FMath::IsNearlyEqual(TraceCoherence.TraceRange, TraceRange))
+		return false;
+
+	if (FMath::RadiansToDegrees(TraceCoherence.TraceRotation.AngularDistance(InteractionTraceData.TraceRotation.Quaternion())) > CoherenceAngularThreshold)
+		return false;
+
+	if (activeInteractable->Execute_GetState(activeInteractableObject) != TraceCoherence.InteractableState)
+		return false;
+
+	if (activeInteractable->Execute_GetInteractableWeight(activeInteractableObject) != TraceCoherence.InteractableWeight)
+		return false;
+
+	// Targeted Instance can change or disappear while Interactable stays the same
+	if (TraceCoherence.HitItem != INDEX_NONE)
+		return false;
+
+	if (bVerifyActiveInteractable)
+	{
+		bool bActiveHit = false;
+		FHitResult hitResult;
+		
+		const TArray<UPrimitiveComponent*> collisionComponents = activeInteractable->Execute_GetCollisionComponents(activeInteractableObject);
+		for (UPrimitiveComponent* Itr : collisionComponents)
+		{
+			if (Itr && Itr->LineTraceComponent(hitResult, InteractionTraceData.StartLocation, InteractionTraceData.EndLocation, InteractionTraceData.CollisionParams))
+			{
+				bActiveHit = true;
+				break;
+			}
+		}
+
+		if (!bActiveHit)
+			return false;
+	}
+
+	TraceCoherence.SkippedTraces++;
+	return true;
+}
+
+void UActorInteractorComponentTrace::UpdateTraceCoherence(const FInteractionTraceDataV2& InteractionTraceData)
+{
+	const TScriptInterface<IActorInteractableInterface> activeInteractable = Execute_GetActiveInteractable(this);
+	UObject* activeInteractableObject = activeInteractable.GetObject();
+	if (!bUseTemporalCoherence || !activeInteractableObject)
+	{
+		TraceCoherence.Invalidate();
+		return;
+	}
+
+	TraceCoherence.StartLocation = InteractionTraceData.StartLocation;
+	TraceCoherence.TraceRange = TraceRange;
+	TraceCoherence.TraceRotation = InteractionTraceData.TraceRotation.Quaternion();
+	TraceCoherence.TraceType = TraceType;
+	TraceCoherence.ActiveInteractable = activeInteractableObject;
+	TraceCoherence.InteractableState = activeInteractable->Execute_GetState(activeInteractableObject);
+	TraceCoherence.InteractableWeight = activeInteractable->Execute_GetInteractableWeight(activeInteractableObject);
+	TraceCoherence.SkippedTraces = 0;
+	TraceCoherence.bIsValid = true;
+}
+
+float UActorInteractorComponentTrace::GetTraceSkipRate() const
+{
+	return ProcessedTracesCount > 0 ? static_cast<float>(SkippedTracesCount) / static_cast<float>(ProcessedTracesCount) : 0.f;
+}
+
 bool UActorInteractorComponentTrace::CanTrace_Implementation() const
 {
 	return Execute_CanInteract(this);
@@ -653,8 +1079,9 @@ void UActorInteractorComponentTrace::ResumeTracing_Server_Implementation()
 	ResumeTracing();
 }
 
-void UActorInteractorComponentTrace::ProcessTrace_Server_Implementation()
+void UActorInteractorComponentTrace::ProcessTrace_Server_Implementation(const float ViewTime)
 {
+	SetClientViewTime(ViewTime);
 	ProcessTrace();
 }
 
@@ -672,6 +1099,12 @@ void UActorInteractorComponentTrace::DrawTracingDebugStart(FInteractionTraceData
 			case ETraceType::ETT_Loose:
 				DrawDebugSphere(GetWorld(), InteractionTraceData.StartLocation, 10.f, 6, FColor::Blue, false, TraceInterval, 0, 0.25f);
 				break;
+			case ETraceType::ETT_Cone:
+				DrawDebugCone(GetWorld(), InteractionTraceData.StartLocation, InteractionTraceData.TraceRotation.Vector(), TraceRange, FMath::DegreesToRadians(ConeHalfAngle), FMath::DegreesToRadians(ConeHalfAngle), 12, FColor::Blue, false, TraceInterval, 0, 0.25f);
+				break;
+			case ETraceType::Default:
+			default:
+				break;
 		}
 		
 		DrawDebugSphere(GetWorld(), InteractionTraceData.EndLocation, 10.f, 6, FColor::Red, false, TraceInterval, 0, 0.25f);
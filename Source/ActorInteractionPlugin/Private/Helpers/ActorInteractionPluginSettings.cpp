@@ -5,11 +5,14 @@
 #include "InputMappingContext.h"
 #include "Helpers/ActorInteractionPluginLog.h"
 #include "Helpers/MounteaInteractionSettingsConfig.h"
+#include "Helpers/MounteaInteractionTagBits.h"
 #include "Materials/MaterialInterface.h"
 
 UActorInteractionPluginSettings::UActorInteractionPluginSettings() :
 	bEditorDebugEnabled(true),
-	WidgetUpdateFrequency(0.1f)
+	WidgetUpdateFrequency(0.1f),
+	bFilterTracesByObjectType(false),
+	InteractableObjectType(ECC_GameTraceChannel1)
 {
 	CategoryName = TEXT("Mountea Framework");
 	SectionName = TEXT("Mountea Interaction System");
@@ -20,6 +23,18 @@ TSoftClassPtr<UUserWidget> UActorInteractionPluginSettings::GetInteractableDefau
 	{ return InteractableDefaultWidgetClass; };
 }
 
+#if WITH_EDITOR
+void UActorInteractionPluginSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UActorInteractionPluginSettings, InteractionTagsRoot))
+	{
+		FMounteaInteractionTagBits::Invalidate();
+	}
+}
+#endif
+
 UMaterialInterface* UActorInteractionPluginSettings::GetDefaultHighlightMaterial() const
 {
 	if (DefaultInteractionSystemConfig.LoadSynchronous())
@@ -0,0 +1,159 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+
+#include "Helpers/MounteaInteractableArchetype.h"
+
+#include "Engine/AssetManager.h"
+#include "Net/UnrealNetwork.h"
+
+namespace MounteaInteractableArchetype
+{
+	static uint32 ResolvedClassesGeneration = 0;
+}
+
+FInteractableArchetypeSettings::FInteractableArchetypeSettings()
+	: InteractionPeriod(1.5f)
+	, CooldownPeriod(3.f)
+	, LifecycleMode(EInteractableLifecycle::EIL_Cycled)
+	, LifecycleCount(-1)
+	, HighlightType(EHighlightType::EHT_OverlayMaterial)
+	, bInteractionHighlight(true)
+	, bCanPersist(false)
+	, StencilID(133)
+	, HighlightMaterial(nullptr)
+	, InteractionProgressExpiration(0.f)
+	, ComparisonMethod(ETimingComparison::ECM_None)
+	, TimeToStart(0.001f)
+	, DebugSettings(false)
+{
+}
+
+void FInteractableArchetypeSettings::Sanitize()
+{
+	if (InteractionPeriod > -1.f && InteractionPeriod < 0.1f)
+	{
+		InteractionPeriod = 0.1f;
+	}
+	InteractionPeriod = FMath::Max(-1.f, InteractionPeriod);
+
+	CooldownPeriod = FMath::Max(0.1f, CooldownPeriod);
+
+	if (LifecycleMode == EInteractableLifecycle::EIL_Cycled && (LifecycleCount == 0 || LifecycleCount == 1))
+	{
+		LifecycleCount = 2;
+	}
+	LifecycleCount = FMath::Max(-1, LifecycleCount);
+
+	StencilID = FMath::Clamp(StencilID, 0, 255);
+}
+
+void UMounteaInteractableArchetype::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UMounteaInteractableArchetype, Settings);
+}
+
+void UMounteaInteractableArchetype::PostRepNotifies()
+{
+	Super::PostRepNotifies();
+
+	MarkCompatibleTagsDirty();
+	MarkIgnoredClassesDirty();
+}
+
+const FMounteaInteractionTagBits& UMounteaInteractableArchetype::GetCompatibleTagBits() const
+{
+	if (bCompatibleTagBitsDirty || !CompatibleTagBits.IsCurrent())
+	{
+		CompatibleTagBits = FMounteaInteractionTagBits::FromContainer(Settings.InteractableCompatibleTags);
+		bCompatibleTagBitsDirty = false;
+	}
+
+	return CompatibleTagBits;
+}
+
+bool UMounteaInteractableArchetype::IsInteractorClassIgnored(const UClass* InteractorClass) const
+{
+	if (!InteractorClass || Settings.IgnoredClasses.Num() == 0) return false;
+
+	if (bIgnoredClassesDirty || ResolvedClassesGeneration != MounteaInteractableArchetype::ResolvedClassesGeneration)
+	{
+		ResolveIgnoredClasses();
+	}
+
+	if (const bool* cachedResult = IgnoredClassResults.Find(InteractorClass))
+	{
+		return *cachedResult;
+	}
+
+	bool bIgnored = false;
+	for (const UClass* classItr = InteractorClass; classItr && !bIgnored; classItr = classItr->GetSuperClass())
+	{
+		bIgnored = ResolvedIgnoredClasses.Contains(classItr);
+	}
+
+	IgnoredClassResults.Add(InteractorClass, bIgnored);
+	return bIgnored;
+}
+
+void UMounteaInteractableArchetype::InvalidateResolvedClasses()
+{
+	MounteaInteractableArchetype::ResolvedClassesGeneration++;
+}
+
+void UMounteaInteractableArchetype::ResolveIgnoredClasses() const
+{
+	bIgnoredClassesDirty = false;
+	ResolvedClassesGeneration = MounteaInteractableArchetype::ResolvedClassesGeneration;
+	ResolvedIgnoredClasses.Reset();
+	IgnoredClassResults.Reset();
+
+	TArray<FSoftObjectPath> pendingClasses;
+	for (const TSoftClassPtr<UObject>& ignoredClass : Settings.IgnoredClasses)
+	{
+		if (const UClass* resolvedClass = ignoredClass.Get())
+		{
+			ResolvedIgnoredClasses.Add(resolvedClass);
+		}
+		else if (!ignoredClass.IsNull())
+		{
+			pendingClasses.Add(ignoredClass.ToSoftObjectPath());
+		}
+	}
+
+	// Classes which failed to load are not requested again until Ignored Classes change
+	if (pendingClasses.Num() == 0 || bIgnoredClassesLoadRequested) return;
+
+	// Too early to stream, try again on next query
+	if (!UAssetManager::IsInitialized())
+	{
+		bIgnoredClassesDirty = true;
+		return;
+	}
+
+	bIgnoredClassesLoadRequested = true;
+	IgnoredClassesHandle.Reset();
+
+	TWeakObjectPtr<const UMounteaInteractableArchetype> weakArchetype(this);
+	IgnoredClassesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(pendingClasses, FStreamableDelegate::CreateLambda([weakArchetype]()
+	{
+		if (const UMounteaInteractableArchetype* loadedArchetype = weakArchetype.Get())
+		{
+			loadedArchetype->bIgnoredClassesDirty = true;
+		}
+	}));
+}
+
+#if WITH_EDITOR
+
+void UMounteaInteractableArchetype::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	Settings.Sanitize();
+	MarkCompatibleTagsDirty();
+	MarkIgnoredClassesDirty();
+}
+
+#endif
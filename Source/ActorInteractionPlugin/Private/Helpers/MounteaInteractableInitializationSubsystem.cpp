@@ -0,0 +1,191 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractableInitializationSubsystem.h"
+
+#include "Components/Interactable/ActorInteractableComponentWidgetless.h"
+#include "Components/Interactor/ActorInteractorComponentBase.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+#include "Helpers/MounteaInteractionHandleSubsystem.h"
+#include "Helpers/MounteaInteractionStats.h"
+
+void UMounteaInteractableInitializationSubsystem::RequestInitialization(UActorComponent* Interactable)
+{
+	if (!Interactable) return;
+
+	const UWorld* world = Interactable->GetWorld();
+	const bool bDeferred = GetDefault<UActorInteractionPluginSettings>()->GetInteractableInitializationBudget() > 0.f;
+
+	UMounteaInteractableInitializationSubsystem* initializationSubsystem = bDeferred && world ? world->GetSubsystem<UMounteaInteractableInitializationSubsystem>() : nullptr;
+	if (!initializationSubsystem)
+	{
+		InitializeQueued(Interactable);
+		return;
+	}
+
+	initializationSubsystem->Queue.Add({ Interactable });
+	initializationSubsystem->bQueueSorted = false;
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_QueuedInteractables, initializationSubsystem->Queue.Num());
+}
+
+void UMounteaInteractableInitializationSubsystem::InitializeImmediately(UActorComponent* Interactable)
+{
+	if (!Interactable) return;
+
+	CancelInitialization(Interactable);
+	InitializeQueued(Interactable);
+}
+
+void UMounteaInteractableInitializationSubsystem::CancelInitialization(UActorComponent* Interactable)
+{
+	const UWorld* world = Interactable ? Interactable->GetWorld() : nullptr;
+	UMounteaInteractableInitializationSubsystem* initializationSubsystem = world ? world->GetSubsystem<UMounteaInteractableInitializationSubsystem>() : nullptr;
+	if (!initializationSubsystem) return;
+
+	// Entries are only reset, queue may be iterated right now
+	for (FQueuedInteractable& queuedInteractable : initializationSubsystem->Queue)
+	{
+		if (queuedInteractable.Interactable.Get() == Interactable)
+		{
+			queuedInteractable.Interactable.Reset();
+		}
+	}
+}
+
+void UMounteaInteractableInitializationSubsystem::Flush()
+{
+	MOUNTEA_INTERACTION_SCOPE(FlushInteractables, STAT_MounteaInteraction_InitializeInteractables);
+
+	SortQueue();
+
+	// Initialization may queue other Interactables, index loop picks them up too
+	for (int32 i = 0; i < Queue.Num(); i++)
+	{
+		InitializeQueued(Queue[i].Interactable.Get());
+	}
+
+	Queue.Reset();
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_QueuedInteractables, 0);
+}
+
+void UMounteaInteractableInitializationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	MOUNTEA_INTERACTION_SCOPE(InitializeInteractables, STAT_MounteaInteraction_InitializeInteractables);
+
+	const double budgetSeconds = GetDefault<UActorInteractionPluginSettings>()->GetInteractableInitializationBudget() / 1000.0;
+	const double startTime = FPlatformTime::Seconds();
+
+	// Sorting is part of the frame cost, it counts against the budget
+	SortQueue();
+
+	int32 processedCount = 0;
+	while (processedCount < Queue.Num())
+	{
+		// At least one Interactable per frame, so queue drains even with tiny budget
+		if (processedCount > 0 && FPlatformTime::Seconds() - startTime >= budgetSeconds)
+			break;
+
+		UActorComponent* interactable = Queue[processedCount].Interactable.Get();
+		processedCount++;
+
+		InitializeQueued(interactable);
+	}
+
+	// Flush from within initialization empties queue
+	Queue.RemoveAt(0, FMath::Min(processedCount, Queue.Num()), EAllowShrinking::No);
+
+	SET_DWORD_STAT(STAT_MounteaInteraction_QueuedInteractables, Queue.Num());
+}
+
+bool UMounteaInteractableInitializationSubsystem::IsTickable() const
+{
+	return Queue.Num() > 0;
+}
+
+TStatId UMounteaInteractableInitializationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMounteaInteractableInitializationSubsystem, STATGROUP_Tickables);
+}
+
+bool UMounteaInteractableInitializationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMounteaInteractableInitializationSubsystem::SortQueue()
+{
+	if (bQueueSorted) return;
+	bQueueSorted = true;
+
+	if (Queue.Num() < 2) return;
+
+	TArray<FVector> interactorLocations;
+	GatherInteractorLocations(interactorLocations);
+
+	if (interactorLocations.Num() == 0) return;
+
+	for (FQueuedInteractable& queuedInteractable : Queue)
+	{
+		const UActorComponent* interactable = queuedInteractable.Interactable.Get();
+		const AActor* interactableOwner = interactable ? interactable->GetOwner() : nullptr;
+		if (!interactableOwner)
+		{
+			queuedInteractable.Priority = TNumericLimits<double>::Max();
+			continue;
+		}
+
+		const FVector interactableLocation = interactableOwner->GetActorLocation();
+
+		double closestDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& interactorLocation : interactorLocations)
+		{
+			closestDistanceSquared = FMath::Min(closestDistanceSquared, FVector::DistSquared(interactableLocation, interactorLocation));
+		}
+
+		queuedInteractable.Priority = closestDistanceSquared;
+	}
+
+	Queue.StableSort([](const FQueuedInteractable& A, const FQueuedInteractable& B)
+	{
+		return A.Priority < B.Priority;
+	});
+}
+
+void UMounteaInteractableInitializationSubsystem::GatherInteractorLocations(TArray<FVector>& OutLocations) const
+{
+	const UWorld* world = GetWorld();
+	const UMounteaInteractionHandleSubsystem* handleSubsystem = world ? world->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+	if (!handleSubsystem) return;
+
+	const bool bIsClient = world->GetNetMode() == NM_Client;
+
+	handleSubsystem->ForEachObject([&OutLocations, bIsClient](UObject* RegisteredObject)
+	{
+		const UActorInteractorComponentBase* interactor = Cast<UActorInteractorComponentBase>(RegisteredObject);
+		const AActor* interactorOwner = interactor ? interactor->GetOwner() : nullptr;
+		if (!interactorOwner) return;
+
+		// Clients see Interactors of other players too, only their own ones matter
+		if (bIsClient && !interactorOwner->HasLocalNetOwner()) return;
+
+		OutLocations.Add(interactorOwner->GetActorLocation());
+	});
+}
+
+void UMounteaInteractableInitializationSubsystem::InitializeQueued(UActorComponent* Interactable)
+{
+	VisitInteractableComponent(Interactable, [](auto* QueuedInteractable)
+	{
+		if (!QueuedInteractable->HasBegunPlay() || QueuedInteractable->IsInteractableInitialized()) return;
+
+		QueuedInteractable->InitializeInteractable();
+
+		INC_DWORD_STAT(STAT_MounteaInteraction_DeferredInitializations);
+	});
+}
@@ -0,0 +1,25 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractableProviderSubsystem.h"
+
+#include "Engine/World.h"
+#include "Helpers/MounteaInteractionStats.h"
+#include "Interfaces/ActorInteractorInterface.h"
+
+void UMounteaInteractableProviderSubsystem::RequestPromotion(const UWorld* World, const FVector& Start, const FVector& End, const float Radius, const TScriptInterface<IActorInteractorInterface>& Interactor)
+{
+	if (!World)
+		return;
+
+	MOUNTEA_INTERACTION_SCOPE(RequestPromotion, STAT_MounteaInteraction_ProviderPromotion);
+
+	for (UMounteaInteractableProviderSubsystem* provider : World->GetSubsystemArray<UMounteaInteractableProviderSubsystem>())
+	{
+		provider->PromoteInteractables(Start, End, Radius, Interactor);
+	}
+}
+
+bool UMounteaInteractableProviderSubsystem::HasProviders(const UWorld* World)
+{
+	return World && World->GetSubsystemArray<UMounteaInteractableProviderSubsystem>().Num() > 0;
+}
@@ -0,0 +1,118 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionHandleSubsystem.h"
+
+#include "Engine/World.h"
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/MounteaInteractionStats.h"
+
+FMounteaInteractionHandle UMounteaInteractionHandleSubsystem::RegisterObject(UObject* Object)
+{
+	if (!Object) return FMounteaInteractionHandle();
+
+	if (const FMounteaInteractionHandle* existingHandle = ObjectHandles.Find(Object))
+	{
+		return *existingHandle;
+	}
+
+	uint32 index = 0;
+	if (FreeIndices.Num() > 0)
+	{
+		index = FreeIndices.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		if (Entries.Num() > static_cast<int32>(FMounteaInteractionHandle::MaxIndex))
+		{
+			LOG_ERROR(TEXT("[RegisterObject] Interaction Handles exhausted, %s cannot be used by Interaction RPCs!"), *Object->GetName())
+			return FMounteaInteractionHandle();
+		}
+
+		index = static_cast<uint32>(Entries.AddDefaulted());
+	}
+
+	FHandleEntry& handleEntry = Entries[index];
+	// Serial 0 marks invalid Handle
+	handleEntry.Serial = handleEntry.Serial == FMounteaInteractionHandle::MaxSerial ? 1 : handleEntry.Serial + 1;
+	handleEntry.Object = Object;
+
+	const FMounteaInteractionHandle newHandle(index, handleEntry.Serial);
+	ObjectHandles.Add(Object, newHandle);
+
+	INC_DWORD_STAT(STAT_MounteaInteraction_InteractionHandles);
+
+	return newHandle;
+}
+
+void UMounteaInteractionHandleSubsystem::BindHandle(const FMounteaInteractionHandle& Handle, UObject* Object)
+{
+	if (!Handle.IsValid() || !Object) return;
+
+	if (Entries.Num() <= static_cast<int32>(Handle.GetIndex()))
+	{
+		Entries.SetNum(Handle.GetIndex() + 1);
+	}
+
+	FHandleEntry& handleEntry = Entries[Handle.GetIndex()];
+	if (UObject* previousObject = handleEntry.Object.Get())
+	{
+		ObjectHandles.Remove(previousObject);
+	}
+	else if (handleEntry.Serial == 0)
+	{
+		INC_DWORD_STAT(STAT_MounteaInteraction_InteractionHandles);
+	}
+
+	handleEntry.Object = Object;
+	handleEntry.Serial = Handle.GetSerial();
+
+	ObjectHandles.Add(Object, Handle);
+}
+
+void UMounteaInteractionHandleSubsystem::ReleaseHandle(const FMounteaInteractionHandle& Handle)
+{
+	if (!Handle.IsValid() || !Entries.IsValidIndex(Handle.GetIndex())) return;
+
+	FHandleEntry& handleEntry = Entries[Handle.GetIndex()];
+	if (handleEntry.Serial != Handle.GetSerial()) return;
+
+	if (UObject* releasedObject = handleEntry.Object.Get())
+	{
+		ObjectHandles.Remove(releasedObject);
+	}
+	handleEntry.Object.Reset();
+
+	// Clients mirror Server indices, only Server reuses them
+	if (GetWorld() && GetWorld()->GetNetMode() != NM_Client)
+	{
+		FreeIndices.Add(Handle.GetIndex());
+	}
+	else
+	{
+		handleEntry.Serial = 0;
+	}
+
+	DEC_DWORD_STAT(STAT_MounteaInteraction_InteractionHandles);
+}
+
+UObject* UMounteaInteractionHandleSubsystem::ResolveHandle(const FMounteaInteractionHandle& Handle) const
+{
+	if (!Handle.IsValid() || !Entries.IsValidIndex(Handle.GetIndex())) return nullptr;
+
+	const FHandleEntry& handleEntry = Entries[Handle.GetIndex()];
+	return handleEntry.Serial == Handle.GetSerial() ? handleEntry.Object.Get() : nullptr;
+}
+
+FMounteaInteractionHandle UMounteaInteractionHandleSubsystem::FindHandle(const UObject* Object) const
+{
+	const FMounteaInteractionHandle* foundHandle = Object ? ObjectHandles.Find(Object) : nullptr;
+	return foundHandle ? *foundHandle : FMounteaInteractionHandle();
+}
+
+FMounteaInteractionHandle UMounteaInteractionHandleSubsystem::GetHandle(const UObject* Object)
+{
+	const UWorld* world = Object ? Object->GetWorld() : nullptr;
+	const UMounteaInteractionHandleSubsystem* handleSubsystem = world ? world->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+
+	return handleSubsystem ? handleSubsystem->FindHandle(Object) : FMounteaInteractionHandle();
+}
@@ -0,0 +1,88 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionRewindBuffer.h"
+
+void FMounteaInteractionRewindBuffer::Initialize(const int32 Capacity)
+{
+	Samples.Empty(Capacity);
+	Samples.SetNum(Capacity);
+	Head = 0;
+	Count = 0;
+}
+
+void FMounteaInteractionRewindBuffer::Release()
+{
+	Samples.Empty();
+	Head = 0;
+	Count = 0;
+}
+
+void FMounteaInteractionRewindBuffer::AddSample(const float Time, const FTransform& Transform, const float MinInterval)
+{
+	if (Samples.Num() == 0)
+		return;
+
+	// Moving Owner updates every frame, keep samples spaced and only refresh the newest one
+	if (Count > 1 && Time - GetSample(1).Time < MinInterval)
+	{
+		Head = (Head - 1 + Samples.Num()) % Samples.Num();
+		Count--;
+	}
+
+	FRewindSample& sample = Samples[Head];
+	sample.Location = Transform.GetLocation();
+	sample.Rotation = FQuat4f(Transform.GetRotation());
+	sample.Time = Time;
+
+	Head = (Head + 1) % Samples.Num();
+	Count = FMath::Min(Count + 1, Samples.Num());
+}
+
+void FMounteaInteractionRewindBuffer::HoldNewestSample(const float Time)
+{
+	if (Count == 0 || Time <= GetSample(0).Time + KINDA_SMALL_NUMBER)
+		return;
+
+	const FRewindSample newestSample = GetSample(0);
+
+	FRewindSample& sample = Samples[Head];
+	sample = newestSample;
+	sample.Time = Time;
+
+	Head = (Head + 1) % Samples.Num();
+	Count = FMath::Min(Count + 1, Samples.Num());
+}
+
+bool FMounteaInteractionRewindBuffer::GetTransformAt(const float Time, FTransform& OutTransform) const
+{
+	if (Count == 0)
+		return false;
+
+	// Samples are walked from the newest, rewinding is expected to go only a few samples back
+	const FRewindSample* newerSample = &GetSample(0);
+	if (Time >= newerSample->Time)
+	{
+		OutTransform = FTransform(FQuat(newerSample->Rotation), newerSample->Location);
+		return true;
+	}
+
+	for (int32 ageIndex = 1; ageIndex < Count; ageIndex++)
+	{
+		const FRewindSample& olderSample = GetSample(ageIndex);
+		if (Time >= olderSample.Time)
+		{
+			const float alpha = FMath::GetRangePct(olderSample.Time, newerSample->Time, Time);
+			OutTransform = FTransform
+			(
+				FQuat(FQuat4f::Slerp(olderSample.Rotation, newerSample->Rotation, alpha)),
+				FMath::Lerp(olderSample.Location, newerSample->Location, static_cast<double>(alpha))
+			);
+			return true;
+		}
+
+		newerSample = &olderSample;
+	}
+
+	OutTransform = FTransform(FQuat(newerSample->Rotation), newerSample->Location);
+	return true;
+}
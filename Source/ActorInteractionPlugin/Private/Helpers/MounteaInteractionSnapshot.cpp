@@ -0,0 +1,214 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionSnapshot.h"
+
+#include "Components/Interactable/ActorInteractableComponentWidgetless.h"
+#include "Engine/World.h"
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/MounteaInteractionHandleSubsystem.h"
+#include "Helpers/MounteaInteractionStats.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace MounteaInteractionSnapshot
+{
+	enum ERecordFields : uint8
+	{
+		ERF_None				= 0,
+		ERF_Cooldown		= 1 << 0,
+		// Reserved, Interaction Progress is never restored
+		ERF_Progress			= 1 << 1
+	};
+
+	// Zigzag keeps small negative values in single packed byte
+	static uint32 EncodeSigned(const int32 Value)
+	{ return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31); }
+
+	static int32 DecodeSigned(const uint32 Value)
+	{ return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1); }
+}
+
+FArchive& operator<<(FArchive& Ar, FMounteaInteractableSnapshotRecord& Record)
+{
+	using namespace MounteaInteractionSnapshot;
+
+	uint8 recordFields = ERF_None;
+	if (Ar.IsSaving())
+	{
+		recordFields |= Record.RemainingCooldown > 0.f ? ERF_Cooldown : ERF_None;
+	}
+
+	Ar << Record.Id;
+	Ar << recordFields;
+
+	uint8 state = static_cast<uint8>(Record.State);
+	Ar << state;
+
+	// Corrupted data must never produce State outside of the enum
+	if (Ar.IsLoading() && state > static_cast<uint8>(EInteractableStateV2::Default))
+	{
+		Ar.SetError();
+		state = static_cast<uint8>(EInteractableStateV2::Default);
+	}
+	Record.State = static_cast<EInteractableStateV2>(state);
+
+	uint32 remainingLifecycleCount = EncodeSigned(Record.RemainingLifecycleCount);
+	Ar.SerializeIntPacked(remainingLifecycleCount);
+	Record.RemainingLifecycleCount = DecodeSigned(remainingLifecycleCount);
+
+	uint32 interactionWeight = EncodeSigned(Record.InteractionWeight);
+	Ar.SerializeIntPacked(interactionWeight);
+	Record.InteractionWeight = DecodeSigned(interactionWeight);
+
+	if (recordFields & ERF_Cooldown)
+		Ar << Record.RemainingCooldown;
+	else
+		Record.RemainingCooldown = 0.f;
+
+	// Snapshots written before Progress was dropped still carry it
+	if (recordFields & ERF_Progress)
+	{
+		float progress = 0.f;
+		Ar << progress;
+	}
+
+	return Ar;
+}
+
+void FMounteaInteractionSnapshot::WriteRecords(const TArray<FMounteaInteractableSnapshotRecord>& Records, TArray<uint8>& OutBlob)
+{
+	OutBlob.Reset();
+
+	FMemoryWriter writer(OutBlob);
+
+	uint32 magic = Magic;
+	uint32 version = Version;
+	uint32 recordsCount = Records.Num();
+
+	writer << magic;
+	writer.SerializeIntPacked(version);
+	writer.SerializeIntPacked(recordsCount);
+
+	for (FMounteaInteractableSnapshotRecord record : Records)
+	{
+		writer << record;
+	}
+}
+
+bool FMounteaInteractionSnapshot::ReadRecords(const TArray<uint8>& Blob, TArray<FMounteaInteractableSnapshotRecord>& OutRecords)
+{
+	OutRecords.Reset();
+
+	FMemoryReader reader(Blob);
+
+	uint32 magic = 0;
+	uint32 version = 0;
+	uint32 recordsCount = 0;
+
+	reader << magic;
+	if (reader.IsError() || magic != Magic)
+	{
+		LOG_ERROR(TEXT("[ReadRecords] Blob is not Interaction Snapshot!"))
+		return false;
+	}
+
+	reader.SerializeIntPacked(version);
+	if (version > Version)
+	{
+		LOG_ERROR(TEXT("[ReadRecords] Snapshot version %u is newer than supported version %u!"), version, Version)
+		return false;
+	}
+
+	reader.SerializeIntPacked(recordsCount);
+
+	// Every record takes at least 12 bytes, corrupted counts must not reserve huge arrays
+	OutRecords.Reserve(static_cast<int32>(FMath::Min<int64>(recordsCount, Blob.Num() / 12)));
+	for (uint32 recordIndex = 0; recordIndex < recordsCount && !reader.IsError(); recordIndex++)
+	{
+		reader << OutRecords.AddDefaulted_GetRef();
+	}
+
+	if (reader.IsError())
+	{
+		LOG_ERROR(TEXT("[ReadRecords] Snapshot is truncated or corrupted!"))
+		OutRecords.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+int32 FMounteaInteractionSnapshot::Capture(const UWorld* World, TArray<uint8>& OutBlob, const ULevel* Level)
+{
+	MOUNTEA_INTERACTION_SCOPE(CaptureSnapshot, STAT_MounteaInteraction_CaptureSnapshot);
+
+	const UMounteaInteractionHandleSubsystem* handleSubsystem = World ? World->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+	if (!handleSubsystem)
+	{
+		LOG_ERROR(TEXT("[Capture] No Interaction Handle Subsystem in World!"))
+		return 0;
+	}
+
+	TArray<FMounteaInteractableSnapshotRecord> records;
+	handleSubsystem->ForEachObject([&records, Level](UObject* Object)
+	{
+		VisitInteractableComponent(Object, [&records, Level](const auto* Interactable)
+		{
+			if (Level && Interactable->GetComponentLevel() != Level)
+				return;
+
+			Interactable->CaptureSnapshotRecord(records.AddDefaulted_GetRef());
+		});
+	});
+
+	WriteRecords(records, OutBlob);
+	return records.Num();
+}
+
+int32 FMounteaInteractionSnapshot::Restore(const UWorld* World, const TArray<uint8>& Blob)
+{
+	MOUNTEA_INTERACTION_SCOPE(RestoreSnapshot, STAT_MounteaInteraction_RestoreSnapshot);
+
+	const UMounteaInteractionHandleSubsystem* handleSubsystem = World ? World->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+	if (!handleSubsystem)
+	{
+		LOG_ERROR(TEXT("[Restore] No Interaction Handle Subsystem in World!"))
+		return -1;
+	}
+
+	TArray<FMounteaInteractableSnapshotRecord> records;
+	if (!ReadRecords(Blob, records)) return -1;
+
+	TMap<uint64, UActorComponent*> interactables;
+	interactables.Reserve(records.Num());
+	handleSubsystem->ForEachObject([&interactables](UObject* Object)
+	{
+		VisitInteractableComponent(Object, [&interactables](auto* Interactable)
+		{
+			if (!Interactable->GetOwner() || !Interactable->GetOwner()->HasAuthority())
+				return;
+
+			UActorComponent*& mappedInteractable = interactables.FindOrAdd(Interactable->GetSnapshotId(), nullptr);
+			if (mappedInteractable)
+			{
+				LOG_WARNING(TEXT("[Restore] %s and %s share Snapshot ID, override GetSnapshotId for runtime spawned Actors!"), *mappedInteractable->GetPathName(), *Interactable->GetPathName())
+			}
+			mappedInteractable = Interactable;
+		});
+	});
+
+	int32 restoredCount = 0;
+	for (const FMounteaInteractableSnapshotRecord& record : records)
+	{
+		if (UActorComponent* const* interactable = interactables.Find(record.Id))
+		{
+			VisitInteractableComponent(*interactable, [&record](auto* Interactable)
+			{
+				Interactable->RestoreSnapshotRecord(record);
+			});
+			restoredCount++;
+		}
+	}
+
+	return restoredCount;
+}
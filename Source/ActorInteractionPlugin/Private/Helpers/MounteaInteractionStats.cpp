@@ -0,0 +1,38 @@
+// Copyright Dominik Morse (Pavlicek) 2024. All Rights Reserved.
+
+#include "Helpers/MounteaInteractionStats.h"
+
+// Cycle counters
+DEFINE_STAT(STAT_MounteaInteraction_ProcessTrace);
+DEFINE_STAT(STAT_MounteaInteraction_TraceQuery);
+DEFINE_STAT(STAT_MounteaInteraction_SafetyTrace);
+DEFINE_STAT(STAT_MounteaInteraction_HandleStartOverlap);
+DEFINE_STAT(STAT_MounteaInteraction_HandleEndOverlap);
+DEFINE_STAT(STAT_MounteaInteraction_InteractableSetState);
+DEFINE_STAT(STAT_MounteaInteraction_InteractorSetState);
+DEFINE_STAT(STAT_MounteaInteraction_ProcessDependencies);
+DEFINE_STAT(STAT_MounteaInteraction_Highlight);
+DEFINE_STAT(STAT_MounteaInteraction_WidgetUpdate);
+DEFINE_STAT(STAT_MounteaInteraction_ProviderPromotion);
+DEFINE_STAT(STAT_MounteaInteraction_RewindValidation);
+DEFINE_STAT(STAT_MounteaInteraction_CaptureSnapshot);
+DEFINE_STAT(STAT_MounteaInteraction_RestoreSnapshot);
+DEFINE_STAT(STAT_MounteaInteraction_InitializeInteractables);
+
+// Tracing
+DEFINE_STAT(STAT_MounteaInteraction_TracesFull);
+DEFINE_STAT(STAT_MounteaInteraction_TracesSkipped);
+DEFINE_STAT(STAT_MounteaInteraction_HitsEvaluated);
+DEFINE_STAT(STAT_MounteaInteraction_SafetyTraces);
+
+// State, Presentation & Network
+DEFINE_STAT(STAT_MounteaInteraction_StateTransitions);
+DEFINE_STAT(STAT_MounteaInteraction_WidgetUpdates);
+DEFINE_STAT(STAT_MounteaInteraction_RPCsSent);
+DEFINE_STAT(STAT_MounteaInteraction_PresentationUpdates);
+DEFINE_STAT(STAT_MounteaInteraction_BatchedStarts);
+DEFINE_STAT(STAT_MounteaInteraction_RewoundValidations);
+DEFINE_STAT(STAT_MounteaInteraction_DeferredInitializations);
+DEFINE_STAT(STAT_MounteaInteraction_QueuedInteractables);
+DEFINE_STAT(STAT_MounteaInteraction_InteractionHandles);
+DEFINE_STAT(STAT_MounteaInteraction_RewindMemory);
@@ -4,6 +4,7 @@
 #include "Helpers/MounteaInteractionSystemBFL.h"
 #include "Helpers/ActorInteractionPluginSettings.h"
 #include "Helpers/MounteaInteractionSettingsConfig.h"
+#include "Helpers/MounteaInteractionSnapshot.h"
 
 #include "CommonInputSubsystem.h"
 #include "CommonInputTypeEnum.h"
@@ -19,8 +20,19 @@
 
 #include "Components/MeshComponent.h"
 
+#include "Engine/Engine.h"
 #include "Engine/World.h"
 
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarMounteaInteractionCosmetics
+(
+	TEXT("Mountea.Interaction.Cosmetics"),
+	true,
+	TEXT("When false, Interactables and Interactors skip cosmetic setup and data in every net mode, the same way as on dedicated servers.\n")
+	TEXT("Applies to components which begin play afterwards. Used to profile server cost in Editor and on Clients.")
+);
+
 UMeshComponent* UMounteaInteractionSystemBFL::FindMeshByTag(const FName Tag, const AActor* Source)
 {
 	if (!Source) return nullptr;
@@ -100,7 +112,14 @@ UActorInteractionPluginSettings* UMounteaInteractionSystemBFL::GetInteractionSys
 
 bool UMounteaInteractionSystemBFL::CanExecuteCosmeticEvents(const UWorld* WorldContext)
 {
+#if UE_SERVER
+	// Server-only builds never run cosmetics
+	return false;
+#else
+	if (!CVarMounteaInteractionCosmetics.GetValueOnAnyThread()) return false;
+
 	return !UKismetSystemLibrary::IsDedicatedServer(WorldContext);
+#endif
 }
 
 FText UMounteaInteractionSystemBFL::ReplaceRegexInText(const FText& SourceText, const TMap<FString, FText>& Replacements)
@@ -251,4 +270,16 @@ bool UMounteaInteractionSystemBFL::IsInputKeyPairSupported(APlayerController* Pl
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+int32 UMounteaInteractionSystemBFL::CaptureInteractablesSnapshot(const UObject* WorldContextObject, TArray<uint8>& Snapshot)
+{
+	const UWorld* world = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return FMounteaInteractionSnapshot::Capture(world, Snapshot);
+}
+
+int32 UMounteaInteractionSystemBFL::RestoreInteractablesSnapshot(const UObject* WorldContextObject, const TArray<uint8>& Snapshot)
+{
+	const UWorld* world = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return FMounteaInteractionSnapshot::Restore(world, Snapshot);
+}
@@ -0,0 +1,83 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#include "Helpers/MounteaInteractionTagBits.h"
+
+#include "GameplayTagsManager.h"
+#include "Helpers/ActorInteractionFunctionLibrary.h"
+#include "Helpers/ActorInteractionPluginLog.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+
+namespace MounteaInteractionTagBits
+{
+	static TMap<FGameplayTag, uint64> TagBits;
+	static bool bInitialized = false;
+	static uint32 Generation = 0;
+
+	/**
+	 * Built on first use after Gameplay Tags are loaded or bits are invalidated.
+	 * Shallow Tags get bits first, so only the deepest Tags fall back to `HasTag` in large subtrees.
+	 */
+	static const TMap<FGameplayTag, uint64>& GetTagBits()
+	{
+		if (bInitialized) return TagBits;
+		bInitialized = true;
+
+		const UActorInteractionPluginSettings* interactionSettings = UActorInteractionFunctionLibrary::GetInteractionSettings();
+		const FGameplayTag rootTag = interactionSettings ? interactionSettings->GetInteractionTagsRoot() : FGameplayTag();
+		if (!rootTag.IsValid()) return TagBits;
+
+		TArray<FGameplayTag> subtreeTags;
+		subtreeTags.Add(rootTag);
+		UGameplayTagsManager::Get().RequestGameplayTagChildren(rootTag).GetGameplayTagArray(subtreeTags);
+		subtreeTags.StableSort([](const FGameplayTag& A, const FGameplayTag& B)
+		{
+			return A.GetGameplayTagParents().Num() < B.GetGameplayTagParents().Num();
+		});
+
+		if (subtreeTags.Num() > FMounteaInteractionTagBits::MaxTags)
+		{
+			LOG_WARNING(TEXT("[GetTagBits] %s has %d Tags, only %d of them are matched by bits!"), *rootTag.ToString(), subtreeTags.Num(), FMounteaInteractionTagBits::MaxTags)
+		}
+
+		for (int32 tagIndex = 0; tagIndex < FMath::Min(subtreeTags.Num(), FMounteaInteractionTagBits::MaxTags); tagIndex++)
+		{
+			TagBits.Add(subtreeTags[tagIndex], uint64(1) << tagIndex);
+		}
+
+		return TagBits;
+	}
+}
+
+uint64 FMounteaInteractionTagBits::GetTagBit(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid()) return 0;
+
+	const uint64* tagBit = MounteaInteractionTagBits::GetTagBits().Find(Tag);
+	return tagBit ? *tagBit : 0;
+}
+
+void FMounteaInteractionTagBits::Invalidate()
+{
+	MounteaInteractionTagBits::TagBits.Reset();
+	MounteaInteractionTagBits::bInitialized = false;
+	MounteaInteractionTagBits::Generation++;
+}
+
+uint32 FMounteaInteractionTagBits::GetGeneration()
+{
+	return MounteaInteractionTagBits::Generation;
+}
+
+FMounteaInteractionTagBits FMounteaInteractionTagBits::FromContainer(const FGameplayTagContainer& Tags)
+{
+	FMounteaInteractionTagBits tagBits;
+	tagBits.Generation = GetGeneration();
+
+	// Parent Tags are included, as `HasTag` matches them too
+	for (const FGameplayTag& parentTag : Tags.GetGameplayTagParents())
+	{
+		tagBits.Bits |= GetTagBit(parentTag);
+	}
+
+	return tagBits;
+}
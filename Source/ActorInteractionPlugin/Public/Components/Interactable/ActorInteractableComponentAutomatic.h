@@ -28,6 +28,8 @@ public:
 
 protected:
 
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
+
 	virtual void BeginPlay() override;
 	
 	virtual void OnInteractionCompletedCallback();
@@ -3,12 +3,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Components/MeshComponent.h"
 #include "Components/WidgetComponent.h"
 #include "Engine/DataTable.h"
+#include "UObject/ObjectKey.h"
 
 #include "Interfaces/ActorInteractableInterface.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/MounteaInteractableArchetype.h"
+#include "Helpers/MounteaInteractionStateMachine.h"
 #include "Helpers/MounteaInteractionHelperEvents.h"
+#include "Helpers/MounteaInteractablePresentation.h"
+#include "Helpers/MounteaInteractionRewindBuffer.h"
+#include "Helpers/MounteaInteractionNetTypes.h"
 
 #include "ActorInteractableComponentBase.generated.h"
 
@@ -17,13 +24,28 @@
 class UInputMappingContext;
 enum class ECommonInputType : uint8;
 
+struct FMounteaInteractableSnapshotRecord;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWidgetUpdated);
 
+/**
+ * Queries of Interactable derived from its State and Interactor.
+ * Cached whenever any of them changes, so Interactors evaluate candidates by single mask.
+ */
+enum class EInteractableTriggerFlags : uint8
+{
+	EITF_None					= 0,
+
+	EITF_CanInteract			= 1 << 0,
+	EITF_CanBeTriggered		= 1 << 1,
+};
+ENUM_CLASS_FLAGS(EInteractableTriggerFlags)
 
 /**
  * Actor Interactable Base Component
  *
  * Abstract base class which contains underlying logic for child components.
+ * Presents its own Interaction Widget, see `UActorInteractableComponentWidgetless` for Interactables without transform and Widget.
  *
  * Implements ActorInteractableInterface.
  * Networking is not implemented.
@@ -42,6 +64,7 @@ public:
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitWidget() override;
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -49,6 +72,11 @@ protected:
 	virtual void OnComponentCreated() override;
 	virtual void OnRegister() override;
 
+	virtual void Activate(bool bReset = false) override;
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
 #pragma region InteractableFunctions
 	
 public:
@@ -72,8 +100,9 @@ public:
 	virtual void InteractionCanceled_Implementation() override;
 	virtual void InteractionLifecycleCompleted_Implementation() override;
 	virtual void InteractionCooldownCompleted_Implementation() override;
-	virtual bool CanInteract_Implementation() const override;
-	virtual bool CanBeTriggered_Implementation() const override;
+	// Native subclasses extend queries through ComputeTriggerFlags, so native callers never miss them
+	virtual bool CanInteract_Implementation() const override final;
+	virtual bool CanBeTriggered_Implementation() const override final;
 	virtual bool IsInteracting_Implementation() const override;
 	virtual EInteractableStateV2 GetDefaultState_Implementation() const override;
 	virtual void SetDefaultState_Implementation(const EInteractableStateV2 NewState) override;
@@ -178,37 +207,118 @@ public:
 
 #pragma endregion
 
+#pragma region NativeDispatch
+
+	/**
+	 * Internal events reach their handlers by direct calls.
+	 * Dynamic delegates are broadcast afterwards and serve only as Blueprint notification layer.
+	 * Handlers are called only once the component has begun play.
+	 */
+	
+public:
+
+	virtual void NotifyInteractableSelected(const TScriptInterface<IActorInteractableInterface>& SelectedInteractable) override;
+	virtual void NotifyInteractorFound(const TScriptInterface<IActorInteractorInterface>& FoundInteractor) override;
+	virtual void NotifyInteractorLost(const TScriptInterface<IActorInteractorInterface>& LostInteractor) override;
+	virtual void NotifyInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
+	virtual void NotifyInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex) override;
+	virtual void NotifyInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit) override;
+	virtual void NotifyInteractionStarted(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
+	virtual void NotifyInteractionStopped(const float& TimeStopped, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
+	virtual void NotifyInteractableDependencyStarted(const TScriptInterface<IActorInteractableInterface>& NewMaster) override;
+	virtual void NotifyInteractableDependencyStopped(const TScriptInterface<IActorInteractableInterface>& FormerMaster) override;
+
+	virtual bool GetRewoundTransform(const float Time, FTransform& OutTransform) const override;
+	virtual bool IsCompatibleWithTag(const FGameplayTag& Tag, const uint64 TagBit) const override;
+	virtual bool IsInteractorClassIgnored(const UClass* InteractorClass) const override;
+	virtual bool CanInteractNative() const override;
+	virtual bool CanBeTriggeredNative() const override;
+
+protected:
+
+	void NotifyInteractionCompleted(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
+	void NotifyInteractionCycleCompleted(const float& CompletedTime, const int32 CyclesRemaining, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
+	void NotifyInteractionCanceled();
+	void NotifyCooldownCompleted();
+
+	void NotifyInteractableDependencyChanged(const TScriptInterface<IActorInteractableInterface>& Dependency);
+	void NotifyInteractableWeightChanged(const int32& NewWeight);
+	void NotifyInteractableStateChanged(const EInteractableStateV2& NewState);
+	void NotifyInteractableCollisionChannelChanged(const ECollisionChannel NewChannel);
+	void NotifyLifecycleModeChanged(const EInteractableLifecycle& NewMode);
+	void NotifyLifecycleCountChanged(const int32 NewLifecycleCount);
+	void NotifyInteractorChanged(const TScriptInterface<IActorInteractorInterface>& NewInteractor);
+
+	void NotifyIgnoredInteractorClassAdded(const TSoftClassPtr<UObject>& IgnoredClass);
+	void NotifyIgnoredInteractorClassRemoved(const TSoftClassPtr<UObject>& IgnoredClass);
+
+	void NotifyHighlightableComponentAdded(UMeshComponent* MeshComponent);
+	void NotifyHighlightableComponentRemoved(UMeshComponent* MeshComponent);
+	void NotifyCollisionComponentAdded(UPrimitiveComponent* CollisionComp);
+	void NotifyCollisionComponentRemoved(UPrimitiveComponent* CollisionComp);
+
+	void NotifyHighlightTypeChanged(const EHighlightType& NewHighlightType);
+	void NotifyHighlightMaterialChanged(UMaterialInterface* NewHighlightMaterial);
+
+	void NotifyInteractionDeviceChanged(const ECommonInputType DeviceType, const FName& DeviceName);
+
+#pragma endregion
+
 #pragma region InteractableFunctions_Networking
 
 protected:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack) override;
+
+	/**
+	 * Returns side effects of transition between two States.
+	 * Defaults to `MounteaInteractionStateMachine::InteractableStateTable`.
+	 * Override to add, remove or modify transitions without replacing SetState.
+	 */
+	virtual EInteractableStateEffect GetStateTransitionEffects(const EInteractableStateV2 FromState, const EInteractableStateV2 ToState) const;
+	/**
+	 * Applies side effects of State transition in fixed order.
+	 * Override and call Super to handle `ESE_Custom` effects.
+	 */
+	virtual void ApplyStateTransitionEffects(const EInteractableStateV2 NewState, const EInteractableStateEffect Effects);
 
 	UFUNCTION(Server, Reliable)
 	void SetState_Server(const EInteractableStateV2 NewState);
 
-	UFUNCTION(Client, Reliable)
-	void InteractionStarted_Client(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractionStopped_Client(const float& TimeStopped, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractionCancelled_Client(const float& TimeStopped, const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractorFound_Client(const TScriptInterface<IActorInteractorInterface>& DirtyInteractor);
-	UFUNCTION(Client, Reliable)
-	void InteractorLost_Client(const TScriptInterface<IActorInteractorInterface>& DirtyInteractor);
-
-	UFUNCTION(Client, Unreliable)
-	void ProcessToggleActive_Client(const bool bIsEnabled);
-
-	UFUNCTION(Client, Unreliable)
-	void StartHighlight_Client();
-	UFUNCTION(Client, Unreliable)
-	void StopHighlight_Client();
-	UFUNCTION(Client, Unreliable)
-	void ShowWidget_Client();
-	UFUNCTION(Client, Unreliable)
-	void HideWidget_Client();
+	/**
+	 * Updates Presentation Flags on Server.
+	 * Presentation State is marked dirty only if any Flag has changed.
+	 */
+	void SetPresentationFlags(const EInteractablePresentationFlags Flags, const bool bEnabled);
+	/**
+	 * Sets Interactor presented to Clients.
+	 * Null Interactor clears Interaction Flags as well.
+	 */
+	void SetPresentationInteractor(const TScriptInterface<IActorInteractorInterface>& NewInteractor);
+	/**
+	 * Records Interaction start, Clients start their Interaction Timer from Server Start Time.
+	 */
+	void SetPresentationInteractionStarted(const TScriptInterface<IActorInteractorInterface>& CausingInteractor);
+	/**
+	 * Records Interaction stop, paused Interaction keeps its progress for Clients.
+	 */
+	void SetPresentationInteractionStopped(const bool bPaused);
+	void MarkPresentationStateDirty();
+
+	/**
+	 * Returns Server World time, synchronized on Clients by Game State.
+	 */
+	float GetServerWorldTime() const;
+
+	/**
+	 * Returns whether presentation of given Interactor is applied on this machine.
+	 * Only Client owning the Interactor presents Highlight, Widget and Interaction events.
+	 */
+	bool IsPresentedLocally(const TScriptInterface<IActorInteractorInterface>& PresentedInteractor) const;
+
+	UFUNCTION()
+	void OnRep_PresentationState();
 
 	UFUNCTION()
 	void OnRep_InteractableState();
@@ -216,6 +326,66 @@ protected:
 	UFUNCTION()
 	void OnRep_ActiveInteractor();
 
+	UFUNCTION()
+	void OnRep_InteractionHandle();
+
+#pragma endregion
+
+#pragma region InteractionHandle
+
+public:
+
+	/**
+	 * Returns net-stable Handle of this Interactable, RPCs send it instead of object reference.
+	 */
+	FMounteaInteractionHandle GetInteractionHandle() const
+	{ return InteractionHandle; };
+
+protected:
+
+	/**
+	 * Allocates Handle on Server, binds replicated Handle on Clients.
+	 */
+	void RegisterInteractionHandle();
+	void ReleaseInteractionHandle();
+
+#pragma endregion
+
+#pragma region Initialization
+
+public:
+
+	/**
+	 * Runs setup deferred from BeginPlay: input device binding, Default State and Auto Setup of Collision and Highlightable components.
+	 * Called by `UMounteaInteractableInitializationSubsystem` within its frame budget. Interactable cannot be interacted with until then.
+	 * State set after BeginPlay but before initialization is kept, Default State is applied only if State has not changed since.
+	 */
+	virtual void InitializeInteractable();
+
+	bool IsInteractableInitialized() const
+	{ return bInteractableSetupDone; };
+
+#pragma endregion
+
+#pragma region Snapshot
+
+public:
+
+	/**
+	 * Returns ID this Interactable is stored under in Interaction Snapshots.
+	 * Default is hash of Level package, Actor and Component names, which are stable for placed Actors. Override for Actors spawned at runtime.
+	 */
+	virtual uint64 GetSnapshotId() const;
+
+	virtual void CaptureSnapshotRecord(FMounteaInteractableSnapshotRecord& OutRecord) const;
+
+	/**
+	 * Applies Snapshot Record directly, bypassing State Machine and events. Called on Server only.
+	 * Running Interactions cannot outlive their Interactors, such Interactables are restored Awake.
+	 * Recorded Progress is left to Interactables which can resume Interactions.
+	 */
+	virtual void RestoreSnapshotRecord(const FMounteaInteractableSnapshotRecord& Record);
+
 #pragma endregion
 
 #pragma region Functions
@@ -479,6 +649,20 @@ protected:
 	
 	virtual void CleanupComponent();
 
+	/**
+	 * Clears every timer set on this component, including timers of subclasses.
+	 * Pending Collision Shape changes are applied first, so clearing never drops them.
+	 */
+	virtual void ClearInteractionTimers();
+
+	/**
+	 * Returns whether cosmetic-only data and setup are used.
+	 * Highlightable Meshes, input device bindings and debug draw are never set up when false.
+	 * Always false on dedicated servers.
+	 * Cached once play has begun.
+	 */
+	bool AreCosmeticsEnabled() const;
+
 
 	/**
 	 * Helper function.
@@ -494,6 +678,131 @@ protected:
 	
 	UFUNCTION()	virtual void OnCooldownCompletedCallback();
 
+	/**
+	 * Binds overlap delegates to Collision Shape.
+	 * Called only once per Collision Shape lifetime, override to bind additional delegates.
+	 */
+	virtual void BindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const;
+	virtual void UnbindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const;
+
+	/**
+	 * Returns whether Collision Shape currently participates in interaction queries.
+	 * Delegates stay bound while Interactable sleeps, so delegate handlers should check this first.
+	 */
+	bool IsCollisionShapeActive(const UPrimitiveComponent* PrimitiveComponent) const;
+
+	/**
+	 * Requests query participation change.
+	 * Physics body is not updated immediately, all pending changes are applied in one flush on next tick.
+	 */
+	void SetCollisionShapeActive(UPrimitiveComponent* PrimitiveComponent, FCollisionShapeBinding& ShapeBinding, const bool bActive) const;
+	void FlushCollisionShapes() const;
+	void ApplyCollisionShape(UPrimitiveComponent* PrimitiveComponent, const FCollisionShapeCache& ShapeCache, FCollisionShapeBinding& ShapeBinding) const;
+
+	/**
+	 * Restores pre-interaction settings immediately, unbinds delegates and forgets Collision Shape.
+	 */
+	void ReleaseCollisionShape(UPrimitiveComponent* PrimitiveComponent) const;
+
+#pragma endregion
+
+#pragma region Archetype
+
+public:
+
+	/**
+	 * Returns shared Archetype this Interactable reads its configuration from.
+	 * Could be nullptr, then class defaults are used.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	UMounteaInteractableArchetype* GetInteractableArchetype() const
+	{ return InteractableArchetype; };
+
+	/**
+	 * Sets shared Archetype. Discards any Archetype Override.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Interactable")
+	void SetInteractableArchetype(UMounteaInteractableArchetype* NewArchetype);
+
+	/**
+	 * Returns whether this Interactable owns private copy of Archetype Settings.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	bool HasArchetypeOverride() const
+	{ return ArchetypeOverride != nullptr; };
+
+	/**
+	 * Returns private copy of Archetype Settings owned by this Interactable.
+	 * Could be nullptr, then shared Archetype is used.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	UMounteaInteractableArchetype* GetArchetypeOverride() const
+	{ return ArchetypeOverride; };
+
+	/**
+	 * Discards private copy of Archetype Settings, shared Archetype is used again.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Interactable")
+	void ResetArchetypeOverride();
+
+	/**
+	 * Returns effective configuration.
+	 * Resolution order: Archetype Override -> Interactable Archetype -> class defaults.
+	 */
+	const FInteractableArchetypeSettings& GetArchetypeSettings() const;
+
+protected:
+
+	/**
+	 * Returns writable configuration.
+	 * First call copies shared configuration into Archetype Override, call only when value really changes.
+	 */
+	FInteractableArchetypeSettings& EditArchetypeSettings();
+
+	/**
+	 * Fills class defaults used by Interactables without Archetype.
+	 * Called once per native class, override and call Super to provide class specific values.
+	 */
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const;
+
+	/**
+	 * Returns shared Archetype built from InitializeArchetypeDefaults of the first native class.
+	 */
+	const UMounteaInteractableArchetype* GetClassArchetype() const;
+
+	/**
+	 * Returns Archetype effective configuration is read from.
+	 */
+	const UMounteaInteractableArchetype* GetResolvedArchetype() const;
+
+#pragma endregion
+
+#pragma region LagCompensation
+
+protected:
+
+	/**
+	 * Starts sampling Owner Transform for Lag Compensation.
+	 * Only Server with movable Owner in networked game samples anything, and only when Owner moves.
+	 */
+	void StartRewindSampling();
+	void StopRewindSampling();
+
+	void OnRewindTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+	void SampleRewindTransform();
+
+#pragma endregion
+
+#pragma region RuntimeState
+
+public:
+
+	/**
+	 * Overrides how many Lifecycles remain.
+	 * Used when Interactable continues state kept by another representation, like Mass Entity.
+	 */
+	void SetRemainingLifecycleCount(const int32 NewRemainingLifecycleCount);
+
 #pragma endregion
 
 #pragma endregion
@@ -804,6 +1113,9 @@ public:
 
 	virtual FInteractableStateChanged& GetInteractableStateChanged() override
 	{ return OnInteractableStateChanged; };
+
+	virtual FInteractableWeightChanged& GetInteractableWeightChanged() override
+	{ return OnInteractableWeightChanged; };
 	
 	virtual FOnWidgetUpdated& WidgetUpdatedHandle()
 	{ return OnWidgetUpdated; };
@@ -840,15 +1152,6 @@ public:
 
 protected:
 	
-	/**
-	 * If active, debug can be drawn.
-	 * You can disable Editor Warnings. Editor Errors cannot be disabled!
-	 * Serves a general purpose as a flag.
-	 * Does not affect Shipping builds by default C++ implementation.
-	 */
-	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Debug", meta=(ShowOnlyInnerProperties))
-	FDebugSettings																								DebugSettings;
-
 #if WITH_EDITORONLY_DATA
 	TObjectPtr<UBillboardComponent>																	InteractableSpriteComponent = nullptr;
 #endif
@@ -859,12 +1162,14 @@ protected:
 protected:
 
 	/**
-	 * Defines how long does Interaction take.
-	 * - -1 = immediate
-	 * - 0  = 0.1s
+	 * Shared configuration of this Interactable.
+	 * Interaction and Cooldown Periods, Lifecycle, Highlight, Compatible Tags, Ignored Classes, Overrides and Debug are read from here.
+	 * If empty, class defaults are used.
+	 *
+	 * Archetype is never modified by Interactable, changed values are stored in Archetype Override.
 	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(UIMin=-1, ClampMin=-1, Units="seconds", NoResetToDefault))
-	float																													InteractionPeriod;
+	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
+	TObjectPtr<UMounteaInteractableArchetype>												InteractableArchetype = nullptr;
 
 	/**
 	 * Default state of the Interactable to be set in BeginPlay.
@@ -892,39 +1197,6 @@ protected:
 	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
 	TEnumAsByte<ECollisionChannel>																	CollisionChannel;
 	
-	/**
-	 * How long it takes for Cooldown to finish.
-	 * After this period of time the Interactable will be Awake again, unless no Interactor.
-	 * Clamped in Setter.
-	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault, EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=0.1, ClampMin=0.1, Units="Seconds"))
-	float																													CooldownPeriod;
-
-	/**
-	 * Defines Lifecycle Mode of this Interactable.
-	 * Cycled:
-	 * * Can be used multiple times
-	 * * Good for NPCs
-	 * Once:
-	 * * Can be used only once
-	 * * Good for pickup items
-	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
-	EInteractableLifecycle																						LifecycleMode;
-
-	/**
-	 * How many times this Interactable can be used.
-	 *
-	 * Clamped in Setter.
-	 * Expected range:
-	 * * -1 | Can be used forever
-	 * *  0 | Invalid, will be set to 2
-	 * *  1 | Invalid, will be set to 2
-	 * * 2+ | Will be used defined number of times
-	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Required", meta=(NoResetToDefault, EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=-1, ClampMin=-1, Units="times"))
-	int32																												LifecycleCount;
-
 	/**
 	 * Weight of this Interactable.
 	 * Useful with multiple overlapping Interactables withing the same Actor. Interactor will always prefer the one with highest Weight value.
@@ -940,113 +1212,132 @@ protected:
 #pragma region Optional
 
 protected:
-	
+
 	/**
-	 * 
+	 * Private copy of Archetype Settings owned by this Interactable only.
+	 * Created automatically once any shared value is changed on this Interactable.
+	 * Leave empty to share Interactable Archetype and save memory.
 	 */
-	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
-	FGameplayTagContainer																					InteractableCompatibleTags;
+	UPROPERTY(Replicated, Instanced, SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	TObjectPtr<UMounteaInteractableArchetype>												ArchetypeOverride = nullptr;
 	
 	/**
-	 * List of Interactable Classes which are ignored
+	 * Interactable Data.
+	 * Could be any Data Table.
 	 */
-	UPROPERTY(SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault, AllowAbstract=false, MustImplement="/Script/ActorInteractionPlugin.ActorInteractorInterface", BlueprintBaseOnly))
-	TArray<TSoftClassPtr<UObject>>																	IgnoredClasses;
-	
+	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(ShowOnlyInnerProperties, NoResetToDefault)) //, RequiredAssetDataTags = "RowStructure=/Script/ActorInteractionSystem.InteractionData"))
+	FDataTableRowHandle																					InteractableData;
+
 	/**
-	 * Expects: Actor Tags
-	 * List of Actor Tags which define which Primitive Components should be added to Collision Shapes.
-	 * This way, you can easily specify what Components will act as Collision Shapes, and without using any nodes.
-	 *
-	 * Is used even with Auto Setup.
+	 * Display Name.
 	 */
-	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
-	TArray<FName>																								CollisionOverrides;
+	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	FText																												InteractableName = NSLOCTEXT("InteractableComponentBase", "DefaultInteractable", "Default");
 
 	/**
-	 * Expects: Actor Tags
-	 * List of Actor Tags which define which Mesh Components should be added to Highlightable Meshes.
-	 * This way, you can easily specify what Components will act as Highlightable Meshes, and without using any nodes.
-	 *
-	 * Is used even with Auto Setup.
+	 * Defines whether Server keeps recent Owner Transforms to validate Clients against what they have seen.
+	 * Only movable Owners in networked games use any memory, bounded by Lag Compensation settings.
 	 */
 	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
-	TArray<FName>																								HighlightableOverrides;
+	uint8																												bLagCompensated : 1;
+
+#pragma endregion 
+
+#pragma region Deprecated
+
+#if WITH_EDITORONLY_DATA
+protected:
 
 	/**
-	* Defines what Highlight Type is used.
-	*/
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional")
-	EHighlightType																									HighlightType;
-	
-	/**
-	 * Defines whether Interactable should be highlighted with defined Material when Interaction is possible.
-	 *
-	 * For this option to work following steps must be done:
-	 * * In Level must be PostProcessVolume
-	 * * PostProcessVolume must have set PostProcessMaterials
-	 * * * Custom Depth-Stencil Pass must be enabled
-	 * * * * Projects Settings -> Engine -> Rendering -> PostProcessing
-	 * * * * * Set to value: Enabled with Stencil
-	 */
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional")
-	uint8																												bInteractionHighlight : 1;
-	
+	 * Per-instance configuration saved before Archetypes were introduced.
+	 * Values which differ from template are moved into Archetype Override in PostLoad, see `MigrateDeprecatedSettings`.
+	 */
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	FDebugSettings																								DebugSettings_DEPRECATED = FDebugSettings(false);
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	float																													InteractionPeriod_DEPRECATED = 1.5f;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	float																													CooldownPeriod_DEPRECATED = 3.f;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	EInteractableLifecycle																						LifecycleMode_DEPRECATED = EInteractableLifecycle::EIL_Cycled;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	int32																												LifecycleCount_DEPRECATED = -1;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	FGameplayTagContainer																					InteractableCompatibleTags_DEPRECATED;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	TArray<TSoftClassPtr<UObject>>																	IgnoredClasses_DEPRECATED;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	TArray<FName>																								CollisionOverrides_DEPRECATED;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	TArray<FName>																								HighlightableOverrides_DEPRECATED;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	EHighlightType																									HighlightType_DEPRECATED = EHighlightType::EHT_OverlayMaterial;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	uint8																												bInteractionHighlight_DEPRECATED : 1;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	int32																												StencilID_DEPRECATED = 133;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	TObjectPtr<UMaterialInterface>																		HighlightMaterial_DEPRECATED = nullptr;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	uint8																												bCanPersist_DEPRECATED : 1;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	float																													InteractionProgressExpiration_DEPRECATED = 0.f;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	ETimingComparison																							ComparisonMethod_DEPRECATED = ETimingComparison::ECM_None;
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="Use Archetype Settings instead."))
+	float																													TimeToStart_DEPRECATED = 0.001f;
+
+	void GetDeprecatedSettings(FInteractableArchetypeSettings& OutSettings) const;
+	void SetDeprecatedSettings(const FInteractableArchetypeSettings& NewSettings);
+
+	/**
+	 * Moves deprecated values which differ from template into Archetype Override, then resets them to template values.
+	 */
+	void MigrateDeprecatedSettings();
+#endif
+
+#pragma endregion
+
+#pragma region TriggerFlags
+
+protected:
+
 	/**
-	 * Defines what Stencil ID should be used to highlight the Primitive Mesh Components.
-	 * In order to smoothly integrate with other logic, keep this ID unique!
-	 * Default: 133
+	 * Derives Trigger Flags from current State and Interactor, slow path behind cached flags.
+	 * Override and call Super when queries depend on more values, then call RefreshTriggerFlags whenever those change.
+	 * This is the only native extension point of CanInteract and CanBeTriggered, their implementations are final.
 	 */
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true", UIMin=0, ClampMin=0, UIMax=255, ClampMax=255))
-	int32																												StencilID;
-	
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true"))
-	TObjectPtr<UMaterialInterface>																		HighlightMaterial = nullptr;
+	virtual EInteractableTriggerFlags ComputeTriggerFlags() const;
 
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional")
-	uint8																												bCanPersist : 1;
-	
 	/**
-	 * Provides a simple way to determine how fast Interaction Progress is kept before interaction is cancelled.
-	 * * -1 means never while Interactor is valid
+	 * Caches Trigger Flags, call whenever any value they are derived from changes.
 	 */
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly,  Category="MounteaInteraction|Optional", meta=(UIMin=-1.f, ClampMin=-1.f), meta=(EditCondition="bCanPersist!=false"))
-	float																													InteractionProgressExpiration = 0.f;
-	
+	void RefreshTriggerFlags();
+
 	/**
-	 * Interactable Data.
-	 * Could be any Data Table.
+	 * Builds with checks ensure cached Trigger Flags equal the slow path.
 	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(ShowOnlyInnerProperties, NoResetToDefault)) //, RequiredAssetDataTags = "RowStructure=/Script/ActorInteractionSystem.InteractionData"))
-	FDataTableRowHandle																					InteractableData;
+	void CheckTriggerFlags() const;
+
+	EInteractableTriggerFlags																				TriggerFlags = EInteractableTriggerFlags::EITF_None;
 
 	/**
-	 * Display Name.
+	 * Set once Blueprint overrides CanInteract or CanBeTriggered, native queries then call them.
+	 * Only Blueprint overrides are detected, native subclasses cannot override them.
 	 */
-	UPROPERTY(Replicated, SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
-	FText																												InteractableName = NSLOCTEXT("InteractableComponentBase", "DefaultInteractable", "Default");
+	bool																												bScriptTriggerQueries = false;
 
 	/**
-	 * TODO
-	 * Defines behaviour of TimeToStart.
-	 * Less Than: Interaction will start if key is hold less than TimeToStart.
-	 * More Than: Interaction will start if key is hold more than TimeToStart.
-	 * Currently has no logic tied to it!
+	 * Set once deferred setup has run, see `InitializeInteractable`.
 	 */
-	UPROPERTY(SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
-	ETimingComparison																							ComparisonMethod;
+	bool																												bInteractableSetupDone = false;
 
 	/**
-	 * TODO
-	 * Time in seconds it is required to start this interaction.
-	 * Useful with multiple interactables.
-	 * Depends on 'ComparisonMethod'.
-	 * Currently has no logic tied to it!
+	 * Set when State changes between BeginPlay and deferred setup, so setup does not replace it by Default State.
 	 */
-	UPROPERTY(SaveGame, EditAnywhere, Category="MounteaInteraction|Optional", meta=(UIMin=0.001, ClampMin=0.001, Units="seconds", EditCondition="ComparisonMethod!=ETimingComparison::ECM_None", NoResetToDefault))
-	float																													TimeToStart;
+	bool																												bStateChangedBeforeSetup = false;
 
-#pragma endregion 
+#pragma endregion
 
 #pragma region ReadOnly
 
@@ -1082,6 +1373,11 @@ protected:
 	 */
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(DisplayThumbnail = false, ShowOnlyInnerProperties))
 	mutable TMap<TObjectPtr<UPrimitiveComponent>, FCollisionShapeCache>	CachedCollisionShapesSettings;
+
+	/**
+	 * Runtime binding state of cached Collision Shapes, never saved.
+	 */
+	mutable TMap<TObjectKey<UPrimitiveComponent>, FCollisionShapeBinding>	CollisionShapeBindings;
 	
 	/**
 	 * List of Highlightable Components.
@@ -1090,7 +1386,7 @@ protected:
 	 */
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	TArray<TObjectPtr<UMeshComponent>>														HighlightableComponents;
-	
+
 	/**
 	 * List of Collision Components.
 	 * Those component will be updated to:
@@ -1113,6 +1409,44 @@ protected:
 	FTimerHandle																									Timer_Cooldown;
 	UPROPERTY()
 	FTimerHandle																									Timer_ProgressExpiration;
+	UPROPERTY()
+	mutable FTimerHandle																						Timer_CollisionFlush;
+	/**
+	 * Recent Owner Transforms, Server only.
+	 */
+	FMounteaInteractionRewindBuffer																	RewindBuffer;
+
+	/**
+	 * Minimal time between Rewind samples, Owner moving faster than this only refreshes the newest sample.
+	 */
+	float																												RewindSamplingInterval = 0.f;
+
+	TWeakObjectPtr<USceneComponent>																RewindSampledComponent;
+	FDelegateHandle																								RewindTransformUpdatedHandle;
+
+	/**
+	 * Cosmetic and lifecycle state presented to Clients, push-model replicated.
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_PresentationState)
+	FInteractablePresentationState																	PresentationState;
+
+	UPROPERTY(ReplicatedUsing=OnRep_InteractionHandle)
+	FMounteaInteractionHandle																			InteractionHandle;
+
+	/**
+	 * Presentation State already applied on this Client, OnRep diffs against it.
+	 */
+	FInteractablePresentationState																	AppliedPresentationState;
+
+	/**
+	 * Collision Shapes with requested query participation change waiting for next flush.
+	 */
+	mutable TArray<TWeakObjectPtr<UPrimitiveComponent>>										PendingCollisionShapes;
+
+	/**
+	 * Cached in BeginPlay, Net Mode never changes afterwards, see `AreCosmeticsEnabled`.
+	 */
+	bool																												bCosmeticsEnabled = true;
 
 private:
 
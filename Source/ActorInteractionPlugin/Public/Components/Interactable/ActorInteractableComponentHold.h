@@ -28,6 +28,8 @@ public:
 
 protected:
 
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
+
 	virtual void InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
 
 protected:
@@ -19,14 +19,17 @@ public:
 
 	UActorInteractableComponentHover();
 
+	virtual void NotifyInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
+	virtual void NotifyInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex) override;
+
 protected:
 
-	virtual void BeginPlay() override;
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
 
-	virtual void BindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const override;
-	virtual void UnbindCollisionShape_Implementation(UPrimitiveComponent* PrimitiveComponent) const override;
+	virtual void BindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const override;
+	virtual void UnbindCollisionShapeDelegates(UPrimitiveComponent* PrimitiveComponent) const override;
 
-	virtual bool CanInteract_Implementation() const override;
+	virtual EInteractableTriggerFlags ComputeTriggerFlags() const override;
 
 	
 	UFUNCTION()
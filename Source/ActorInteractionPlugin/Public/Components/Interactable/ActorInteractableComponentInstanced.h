@@ -0,0 +1,191 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorInteractableComponentHold.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
+#include "ActorInteractableComponentInstanced.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UActorInteractableComponentInstanced;
+struct FInteractableCompletedInstances;
+
+/**
+ * Single completed Instance, replicated so Clients hide it as well.
+ */
+USTRUCT()
+struct FInteractableCompletedInstance : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32																												InstanceIndex = INDEX_NONE;
+
+	void PostReplicatedAdd(const FInteractableCompletedInstances& InArraySerializer);
+};
+
+/**
+ * Completed Instances of Instanced Interactable.
+ * Only completions are replicated, Cooldowns and Lifecycles are Server only.
+ */
+USTRUCT()
+struct FInteractableCompletedInstances : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FInteractableCompletedInstance>													Items;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UActorInteractableComponentInstanced>									Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInteractableCompletedInstance, FInteractableCompletedInstances>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractableCompletedInstances> : public TStructOpsTypeTraitsBase2<FInteractableCompletedInstances>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Actor Interactable Instanced Component
+ *
+ * Child class of Actor Interactable Hold Component.
+ * Every Instance of Instanced Static Mesh (or Hierarchical Instanced Static Mesh) is standalone Interactable,
+ * addressed by `FHitResult::Item` of Interactor Trace. Useful for foliage, rubble and other harvestables.
+ *
+ * Per-Instance State, Lifecycle and Cooldown are stored in compact arrays indexed by Instance Index, no Actors nor Timers per Instance.
+ * Component itself stays Awake, only Instances go through Cooldown and Completion.
+ * Completed Instances are hidden, Instance Indices stay stable so they keep matching on Server and Clients.
+ *
+ * Only Trace Interactors can address Instances, Overlap Interactors treat the whole mesh as one Interactable.
+ *
+ * Interactor and State of Interactable are shared by all Instances, so only one Interactor at a time can target and interact
+ * with any Instance. Other Interactors are rejected until it is lost. Split Instances between multiple Instanced Interactables,
+ * e.g. one per foliage cell, when many players harvest the same area at once.
+ * Instance targeted by each Interactor is tracked separately, so Interaction always applies to Instance its Interactor targets.
+ *
+ * Implements ActorInteractableInterface.
+ */
+UCLASS(ClassGroup=(Mountea), meta=(BlueprintSpawnableComponent, DisplayName = "Interactable Component Instanced"))
+class ACTORINTERACTIONPLUGIN_API UActorInteractableComponentInstanced : public UActorInteractableComponentHold
+{
+	GENERATED_BODY()
+
+public:
+
+	UActorInteractableComponentInstanced();
+
+	virtual bool CanBeTriggeredByHit(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor) const override;
+	virtual void NotifyHitTargeted(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor) override;
+
+	/**
+	 * Returns Instance which Interaction applies to.
+	 * INDEX_NONE if no Instance is targeted.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	int32 GetTargetInstance() const
+	{ return TargetInstance; };
+
+	/**
+	 * Returns Instanced Static Mesh whose Instances are Interactable.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	UInstancedStaticMeshComponent* GetInstancedMesh() const
+	{ return InstancedMesh; };
+
+	/**
+	 * Sets Instanced Static Mesh whose Instances are Interactable.
+	 * If not set, the first Instanced Static Mesh in Collision Components or on Owner is used.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Interactable")
+	void SetInstancedMesh(UInstancedStaticMeshComponent* NewInstancedMesh);
+
+	/**
+	 * Returns State of given Instance.
+	 * Valid on Server only, Clients know only whether Instance is Completed.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	EInteractableStateV2 GetInstanceState(const int32 InstanceIndex) const;
+
+	/**
+	 * Returns how many Lifecycles given Instance has left.
+	 * -1 means unlimited.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	int32 GetInstanceRemainingLifecycleCount(const int32 InstanceIndex) const;
+
+	/**
+	 * Hides given Instance. Called on Server and Clients once Instance is Completed.
+	 */
+	void HideInstance(const int32 InstanceIndex) const;
+
+protected:
+
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
+
+	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	virtual void InteractorLost_Implementation(const TScriptInterface<IActorInteractorInterface>& LostInteractor) override;
+	virtual void InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
+	virtual bool TriggerCooldown_Implementation() override;
+	virtual void InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
+
+	UInstancedStaticMeshComponent* FindInstancedMesh() const;
+
+	/**
+	 * Grows per-Instance arrays to cover Instances added at runtime.
+	 */
+	void UpdateInstanceCount(const int32 InstanceCount);
+
+	bool IsInstanceAvailable(const int32 InstanceIndex) const;
+	void CompleteInstance(const int32 InstanceIndex);
+
+protected:
+
+	/**
+	 * Instanced Static Mesh whose Instances are Interactable.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(DisplayThumbnail = false))
+	TObjectPtr<UInstancedStaticMeshComponent>													InstancedMesh;
+
+	/**
+	 * Instance which Interaction applies to.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="MounteaInteraction|Read Only")
+	int32																												TargetInstance = INDEX_NONE;
+
+	/**
+	 * Instance last targeted by each Interactor, only Interactors currently looking at Instances have entry.
+	 */
+	TMap<TObjectKey<UObject>, int32>																InteractorTargetInstances;
+
+	UPROPERTY(Replicated)
+	FInteractableCompletedInstances																	CompletedInstances;
+
+	/**
+	 * Per-Instance State, either Awake, Cooldown or Completed.
+	 */
+	TArray<EInteractableStateV2>																		InstanceStates;
+
+	/**
+	 * Per-Instance remaining Lifecycles. Empty if Lifecycles are unlimited.
+	 */
+	TArray<int32>																								InstanceRemainingLifecycles;
+
+	/**
+	 * Per-Instance World time when Cooldown ends. Empty unless Lifecycle Mode is Cycled.
+	 * Cooldowns are resolved lazily once Instance is targeted again.
+	 */
+	TArray<float>																								InstanceCooldownEnds;
+};
@@ -15,9 +15,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnKeyMashed);
  * Child class of Actor Interactable Base Component.
  * This component requires to press interaction key multiple times within specified time period.
  * This interaction can fail if the interaction key is not pressed enough times or time runs out.
+ *
+ * Key presses are stored as timestamps in fixed size ring buffer, Keystroke Threshold is evaluated from timestamps.
+ * Only single deadline timer is armed and it is re-armed lazily once it fires, not on every key press.
+ * Clients send key presses in batches carrying their count and time span.
  * 
  * Implements ActorInteractableInterface.
- * Networking is not implemented.
  *
  * @see https://github.com/Mountea-Framework/ActorInteractionPlugin/wiki/Actor-Interactable-Component-Mash
  */
@@ -31,13 +34,19 @@ public:
 	UActorInteractableComponentMash();
 
 protected:
+
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
 	
-	virtual void BeginPlay() override;
 	virtual void InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
 	virtual void InteractionStopped_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
 	virtual void InteractionCanceled_Implementation() override;
 	virtual void InteractionCompleted_Implementation(const float& TimeCompleted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
 
+public:
+
+	virtual bool CanBatchInteractionStarts() const override;
+	virtual void NotifyInteractionStartsBatched(const int32 Count, const float FirstTime, const float LastTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
+
 protected:
 	
 	/**
@@ -49,6 +58,9 @@ protected:
 	virtual void InteractionFailed();
 	virtual void OnInteractionFailedCallback();
 
+	void NotifyInteractionFailed();
+	void NotifyKeyMashed();
+
 	UFUNCTION()
 	void OnInteractionCompletedCallback();
 	
@@ -60,9 +72,34 @@ protected:
 	void OnKeyMashedEvent();
 
 	virtual void CleanupComponent() override;
+
+	/**
+	 * Registers Key presses evenly spread between First and Last Press Time.
+	 * Fails the Interaction if any gap between presses exceeds Keystroke Threshold.
+	 */
+	void RegisterKeyPresses(const int32 Count, const float FirstPressTime, const float LastPressTime);
+
+	/**
+	 * Arms Keystroke deadline timer for the latest registered press.
+	 */
+	void ScheduleKeystrokeDeadline();
+	void OnKeystrokeDeadline();
+
+	/**
+	 * Returns how late Key presses may arrive. Batched presses from Clients arrive up to Batch Window late.
+	 */
+	float GetKeystrokeGracePeriod() const;
+
+	float GetLastKeyPressTime() const;
 	
 public:
 
+	/**
+	 * Returns how many Key presses per second were registered over recent presses.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
+	float GetMashRate() const;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactable")
 	int32 GetMinMashAmountRequired() const;
 	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Interactable")
@@ -89,6 +126,9 @@ protected:
 
 protected:
 
+	/**
+	 * Single Keystroke deadline timer.
+	 */
 	FTimerHandle TimerHandle_Mashed;
 
 	/**
@@ -96,6 +136,21 @@ protected:
 	 */
 	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	int32 ActualMashAmount;
+
+	static constexpr int32 KeyPressHistorySize = 16;
+
+	/**
+	 * Ring buffer of recent Key press timestamps in World time.
+	 */
+	float KeyPressTimes[KeyPressHistorySize] = {};
+	int32 KeyPressHead = 0;
+	int32 KeyPressCount = 0;
+
+	/**
+	 * Presses registered by next Interaction start, more than one while batch is being processed.
+	 */
+	int32 PendingKeyPressCount = 1;
+	float PendingKeyPressSpan = 0.f;
 	
 protected:
 
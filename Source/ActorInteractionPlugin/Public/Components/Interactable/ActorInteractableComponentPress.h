@@ -28,10 +28,11 @@ public:
 
 protected:
 
+	virtual void InitializeArchetypeDefaults(FInteractableArchetypeSettings& Settings) const override;
+
 	virtual void BeginPlay() override;
 
 	virtual void InteractionStarted_Implementation(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor) override;
-	virtual void SetDefaults_Implementation() override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
@@ -0,0 +1,96 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/WidgetComponent.h"
+
+#include "Interfaces/ActorInteractableInterface.h"
+
+#include "ActorInteractablePromptComponent.generated.h"
+
+/**
+ * Actor Interactable Prompt Component
+ *
+ * Optional companion of Widgetless Interactable Components which presents Interaction Widget.
+ * Widgetless Interactables without Prompt Component work the same way, they only never show any Widget.
+ *
+ * Interactables use Prompt Component assigned by `SetPromptComponent`, otherwise the first Prompt Component found on Owner.
+ * One Prompt Component can be shared by multiple Interactables, it always presents the last shown one.
+ *
+ * Widget Class must implement ActorInteractionWidget interface.
+ */
+UCLASS(ClassGroup=(Mountea), Blueprintable, BlueprintType, hideCategories=(Collision, AssetUserData, Cooking, Physics, Navigation), meta=(BlueprintSpawnableComponent, DisplayName = "Interactable Prompt Component"), meta=(Keywords = "Widget, Prompt, Interactable"))
+class ACTORINTERACTIONPLUGIN_API UActorInteractablePromptComponent : public UWidgetComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UActorInteractablePromptComponent();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void InitWidget() override;
+
+public:
+
+	/**
+	 * Shows Prompt for given Interactable.
+	 * Returns false if there is no Widget to show.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Prompt")
+	bool ShowPrompt(const TScriptInterface<IActorInteractableInterface>& Interactable);
+
+	/**
+	 * Hides Prompt if it currently presents given Interactable and clears presented Interactable.
+	 * Returns false if there is no Widget to hide.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Prompt")
+	bool HidePrompt(const TScriptInterface<IActorInteractableInterface>& Interactable);
+
+	/**
+	 * Pushes current Interactable values to Widget.
+	 * Ignored unless given Interactable is the presented one.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Prompt")
+	void UpdatePrompt(const TScriptInterface<IActorInteractableInterface>& Interactable);
+
+	/**
+	 * Returns Interactable which is currently presented.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Prompt")
+	TScriptInterface<IActorInteractableInterface> GetPresentedInteractable() const
+	{ return PresentedInteractable; };
+
+	/**
+	 * Returns whether Widget Class, or project default one if not set, implements ActorInteractionWidget interface.
+	 */
+	bool ValidatePrompt() const;
+
+	/**
+	 * Returns Widget Class to present, project default Widget Class if none is set.
+	 */
+	TSubclassOf<UUserWidget> GetPromptWidgetClass() const;
+
+protected:
+
+	/**
+	 * Interactable which is currently presented by this Prompt.
+	 */
+	UPROPERTY(Transient, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(DisplayThumbnail = false))
+	TScriptInterface<IActorInteractableInterface>													PresentedInteractable;
+
+#pragma region Editor
+
+#if WITH_EDITOR
+protected:
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+
+#endif
+
+#pragma endregion
+};
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Helpers/InteractionHelpers.h"
+#include "Helpers/MounteaInteractionStateMachine.h"
+#include "Helpers/MounteaInteractionNetTypes.h"
 #include "Interfaces/ActorInteractorInterface.h"
 #include "ActorInteractorComponentBase.generated.h"
 
@@ -32,6 +34,7 @@ public:
 protected:
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 #pragma region Handles
 
@@ -110,6 +113,11 @@ public:
 	virtual bool PerformSafetyTrace_Implementation(const AActor* InteractableActor) override;
 	virtual void SetDefaults_Implementation() override;
 	virtual void ConsumeInput_Implementation(UInputAction* ConsumedInput) override;
+
+	/**
+	 * Returns precomputed bit of Interactor Tag, refreshed if Tag bits were rebuilt since.
+	 */
+	uint64 GetInteractorTagBit() const;
 	
 protected:
 
@@ -117,9 +125,11 @@ protected:
 	void SetState_Server(const EInteractorStateV2 NewState);
 	
 	UFUNCTION(Server, Reliable)
-	void StartInteraction_Server(const float StartTime);
+	void StartInteraction_Server(const float StartTime, const float ViewTime);
 	UFUNCTION(Server, Reliable)
 	void StopInteraction_Server(const float StopTime);
+	UFUNCTION(Server, Reliable)
+	void StartInteractionBatch_Server(const uint8 Count, const float TimeSpan, const float ViewTime);
 
 	UFUNCTION(Server, Unreliable)
 	void AddIgnoredActor_Server(AActor* IgnoredActor);
@@ -131,9 +141,9 @@ protected:
 	void RemoveIgnoredActors_Server(const TArray<AActor*>& IgnoredActors);
 	
 	UFUNCTION(Server, Unreliable)
-	void AddInteractionDependency_Server(const TScriptInterface<IActorInteractorInterface>& InteractionDependency);
+	void AddInteractionDependency_Server(const FMounteaInteractionHandle& InteractionDependency);
 	UFUNCTION(Server, Unreliable)
-	void RemoveInteractionDependency_Server(const TScriptInterface<IActorInteractorInterface>& InteractionDependency);
+	void RemoveInteractionDependency_Server(const FMounteaInteractionHandle& InteractionDependency);
 
 	UFUNCTION(Server, Unreliable)
 	void ProcessDependencies_Server();
@@ -145,7 +155,7 @@ protected:
 	void SetDefaultState_Server(const EInteractorStateV2 NewState);
 
 	UFUNCTION(Server, Reliable)
-	void SetActiveInteractable_Server(const TScriptInterface<IActorInteractableInterface>& NewInteractable);
+	void SetActiveInteractable_Server(const FMounteaInteractionHandle& NewInteractable);
 
 	UFUNCTION(Server, Reliable)
 	void SetInteractorTag_Server(const FGameplayTag& NewInteractorTag);
@@ -154,10 +164,16 @@ protected:
 	void SetSafetyTracingSetup_Server(const FSafetyTracingSetup& NewSafetyTracingSetup);
 
 	UFUNCTION(Client, Reliable)
-	void SetActiveInteractable_Client(const TScriptInterface<IActorInteractableInterface>& NewInteractable);
+	void SetActiveInteractable_Client(const FMounteaInteractionHandle& NewInteractable);
 
 	UFUNCTION()
 	void OnRep_InteractorState();
+
+	UFUNCTION()
+	void OnRep_InteractionHandle();
+
+	UFUNCTION()
+	void OnRep_InteractorTag();
 	
 	UFUNCTION()
 	void OnRep_ActiveInteractable();
@@ -165,12 +181,121 @@ protected:
 	virtual void ProcessStateChanged();
 	virtual void ProcessStateChanged_Client();
 
+	/**
+	 * Returns side effects of transition between two States.
+	 * Defaults to `MounteaInteractionStateMachine::InteractorStateTable`.
+	 * Override to add, remove or modify transitions without replacing SetState.
+	 */
+	virtual EInteractorStateEffect GetStateTransitionEffects(const EInteractorStateV2 FromState, const EInteractorStateV2 ToState) const;
+	/**
+	 * Applies side effects of State transition.
+	 * Override and call Super to handle `ESE_Custom` effects.
+	 */
+	virtual void ApplyStateTransitionEffects(const EInteractorStateV2 NewState, const EInteractorStateEffect Effects);
+
 	virtual void ProcessInteractableChanged();
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack) override;
 
 	virtual bool HasInteractable_Implementation() const override;
 
+#pragma region LagCompensation
+
+public:
+
+	/**
+	 * Returns Server time of the world this Client is presented with.
+	 * Replicated Actors are presented roughly half round trip late.
+	 */
+	float GetClientViewTime() const;
+
+	/**
+	 * Returns Server time Interactables are rewound to while validating owning Client.
+	 * -1 if Interactor is not validated on behalf of remote Client.
+	 */
+	float GetValidationTime() const;
+
+	/**
+	 * Returns Actor Transform at Validation Time.
+	 * Returns current Transform if there is nothing to rewind.
+	 */
+	FTransform GetValidationTransform(const AActor* InteractableActor) const;
+
+protected:
+
+	/**
+	 * Stores View Time received with Server RPC from owning Client.
+	 * Kept as latency, so Server evaluations between RPCs rewind by the same amount.
+	 */
+	void SetClientViewTime(const float ViewTime);
+
+	/**
+	 * How far behind Server the owning Client is presented, clamped to Lag Compensation window.
+	 * -1 if no View Time has been received.
+	 */
+	float ClientViewLatency = -1.f;
+
+#pragma endregion
+
+#pragma region InteractionHandle
+
+public:
+
+	/**
+	 * Returns net-stable Handle of this Interactor, RPCs send it instead of object reference.
+	 */
+	FMounteaInteractionHandle GetInteractionHandle() const
+	{ return InteractionHandle; };
+
+protected:
+
+	/**
+	 * Allocates Handle on Server, binds replicated Handle on Clients.
+	 */
+	void RegisterInteractionHandle();
+	void ReleaseInteractionHandle();
+
+	UPROPERTY(ReplicatedUsing=OnRep_InteractionHandle)
+	FMounteaInteractionHandle InteractionHandle;
+
+#pragma endregion
+
+#pragma region InteractionBatching
+
+protected:
+
+	/**
+	 * Gathers Interaction start for Interactables which accept batched starts.
+	 * First start of a batch arms single timer, batch is sent once it fires.
+	 */
+	void BatchInteractionStart(const float StartTime);
+
+	/**
+	 * Sends gathered Interaction starts to Server as one call carrying their count and time span.
+	 */
+	void FlushInteractionStarts();
+
+	FTimerHandle Timer_InteractionStartBatch;
+
+	uint8 BatchedStartCount = 0;
+	float BatchedStartFirstTime = 0.f;
+	float BatchedStartLastTime = 0.f;
+
+	/**
+	 * Takes up to RequestedCount Interaction starts from allowance, returns how many Server accepts.
+	 * Shared by single and batched starts, so neither path bypasses Max Interaction Start Rate.
+	 */
+	int32 ConsumeStartAllowance(const int32 RequestedCount);
+
+	/**
+	 * Interaction starts Server still accepts from this Interactor, refills at Max Interaction Start Rate.
+	 */
+	float AcceptedStartAllowance = 0.f;
+	float AcceptedStartAllowanceTime = -1.f;
+
+#pragma endregion
+
 public:
 
 	/**
@@ -263,9 +388,17 @@ protected:
 	 * Gameplay Tag which helps further filter out Interaction.
 	 * Requires match in Interactable's `Interactable Tags` container.
 	 */
-	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	UPROPERTY(ReplicatedUsing=OnRep_InteractorTag, EditAnywhere, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
 	FGameplayTag											InteractorTag;
 
+	/**
+	 * Precomputed bit of Interactor Tag, see `FMounteaInteractionTagBits`.
+	 * 0 if Interactor Tag has no bit, then Compatible Tags are matched by Tag.
+	 * Read it through `GetInteractorTagBit`, Tag bits may be rebuilt in Editor.
+	 */
+	mutable uint64												InteractorTagBit = 0;
+	mutable uint32												InteractorTagBitGeneration = 0;
+
 	/**
 	 * If active, debug can be drawn.
 	 * You can disable Editor Warnings. Editor Errors cannot be disabled!
@@ -10,6 +10,33 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionShapeAdded, UPrimitiveComponent*, AddedComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCollisionShapeRemoved, UPrimitiveComponent*, RemovedComponent);
 
+/**
+ * Interactable currently overlapped by Interactor.
+ * Used to promote next best Interactable once Active one is lost.
+ */
+struct FOverlapInteractableCandidate
+{
+	TWeakObjectPtr<UObject>			Interactable;
+	TWeakObjectPtr<AActor>			OwningActor;
+	int32									Weight = INDEX_NONE;
+
+	bool operator==(const FOverlapInteractableCandidate& Other) const
+	{
+		return Interactable == Other.Interactable;
+	}
+};
+
+/**
+ * Heap predicate keeping the highest Weight on top.
+ */
+struct FOverlapInteractableCandidatePredicate
+{
+	bool operator()(const FOverlapInteractableCandidate& A, const FOverlapInteractableCandidate& B) const
+	{
+		return A.Weight > B.Weight;
+	}
+};
+
 /**
  * 
  */
@@ -35,6 +62,9 @@ public:
 	virtual void SetupInteractorOverlap();
 	virtual void BindCollisions();
 	
+	/**
+	 * Overlap events are bound on Server only, Clients are presented its result.
+	 */
 	virtual void BindCollision(UPrimitiveComponent* Component);
 	virtual void UnbindCollisions();
 	virtual void UnbindCollision(UPrimitiveComponent* Component);
@@ -42,7 +72,8 @@ public:
 protected:
 	
 	/**
-	 * 
+	 * Processes overlap of Collision Shape on Server.
+	 * Server receives the same overlaps from its own physics, so Clients do not forward theirs.
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="MounteaInteraction|Tracing")
 	void ProcessOverlap(UPrimitiveComponent* OverlappedComponent,AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& SweepResult, const bool bOverlapStarted);
@@ -56,6 +87,46 @@ protected:
 	void HandleStartOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& HitResult);
 	void HandleEndOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp);
 
+	/**
+	 * Searches for any pair of Interactor Collision Shape and Interactable Collision Component which are overlapping.
+	 * @return True if such pair exists.
+	 */
+	bool FindOverlappingComponents(const TScriptInterface<IActorInteractableInterface>& Interactable, UPrimitiveComponent*& OutInteractorComponent, UPrimitiveComponent*& OutInteractableComponent) const;
+
+#pragma region Candidates
+
+	/**
+	 * Registers overlapped Interactable as candidate.
+	 * Candidates which can be triggered are kept in weight-ordered heap, others are kept dormant until their state changes.
+	 */
+	void AddCandidate(const TScriptInterface<IActorInteractableInterface>& Interactable, AActor* OwningActor);
+	/**
+	 * Removes all candidates owned by given Actor which are no longer overlapped.
+	 */
+	void RemoveCandidates(const AActor* OwningActor);
+	void ClearCandidates();
+	/**
+	 * Re-reads weights and states of all candidates and restores heap order.
+	 */
+	void RefreshCandidates();
+	/**
+	 * Promotes the best triggerable candidate to Active Interactable.
+	 * @return True if any candidate has been promoted.
+	 */
+	bool PromoteCandidate();
+
+	UFUNCTION()
+	void OnCandidateWeightChanged(const int32& NewWeight);
+	UFUNCTION()
+	void OnCandidateStateChanged(const EInteractableStateV2& NewState);
+
+#pragma endregion
+
+	/**
+	 * Asks Interactable Providers to promote Interactables within Collision Shapes.
+	 */
+	void RequestPromotion();
+
 public:
 	
 	/**
@@ -115,15 +186,6 @@ protected:
 	UFUNCTION(Server, Unreliable)
 	void RemoveCollisionComponents_Server(const TArray<UPrimitiveComponent*>& CollisionComponents);
 
-	UFUNCTION(Server, Reliable)
-	void ProcessOverlap_Server(UPrimitiveComponent* OverlappedComponent,AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& SweepResult, const bool bOverlapStarted);
-
-	UFUNCTION(Server, Reliable)
-	void StartInteractorOverlap_Server(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-	UFUNCTION(Server, Reliable)
-	void StopInteractorOverlap_Server(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-
 public:
 
 	UPROPERTY(BlueprintAssignable, Category="Mountea|Interaction|Interactor")
@@ -137,6 +199,17 @@ protected:
 	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optional")
 	TArray<FName>																					OverrideCollisionComponents;
 
+	/**
+	 * How often Interactable Providers (e.g. Mass Entities) are asked to promote Interactables within Collision Shapes.
+	 * Only used when World contains any Interactable Provider.
+	 * * 0 disables promotion
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optional", meta=(UIMin=0.f, ClampMin=0.f, Units="seconds"))
+	float																								PromotionInterval = 0.25f;
+
+	UPROPERTY()
+	FTimerHandle																					Timer_Promotion;
+
 	/**
 	 * A list of Collision Shapes that are used as interactors.
 	 * List is populated on Server Side only!
@@ -153,5 +226,17 @@ private:
 	 */
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="MounteaInteraction|Read Only", meta=(DisplayThumbnail = false, ShowOnlyInnerProperties))
 	mutable TMap<UPrimitiveComponent*, FCollisionShapeCache>			CachedCollisionShapesSettings;
+
+	/**
+	 * Overlapped Interactables which can be triggered, ordered by Weight.
+	 * Server side only.
+	 */
+	TArray<FOverlapInteractableCandidate>										CandidateHeap;
+
+	/**
+	 * Overlapped Interactables which cannot be triggered at the moment.
+	 * Moved to CandidateHeap once their state allows it.
+	 */
+	TArray<FOverlapInteractableCandidate>										DormantCandidates;
 	
 };
\ No newline at end of file
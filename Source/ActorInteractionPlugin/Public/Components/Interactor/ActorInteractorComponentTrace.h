@@ -16,6 +16,7 @@ enum class ETraceType : uint8
 {
 	ETT_Precise		UMETA(DisplayName = "Precise", Tooltip = "Raycast/Line Trace."),
 	ETT_Loose			UMETA(DisplayName = "Loose", Tooltip = "Cubecast/Cube Trace."),
+	ETT_Cone			UMETA(DisplayName = "Cone", Tooltip = "Aim Assist. Interactables in view cone are ranked by angle, distance and weight."),
 
 	Default					 UMETA(hidden)
 };
@@ -31,6 +32,8 @@ struct FInteractionTraceDataV2
 	TArray<FHitResult> HitResults;
 	FCollisionQueryParams CollisionParams;
 	ECollisionChannel CollisionChannel;
+	/** Object Type queried instead of Collision Channel, ECC_MAX to query by Collision Channel. */
+	ECollisionChannel ObjectType = ECC_MAX;
 
 	// Default zero constructor
 	FInteractionTraceDataV2()
@@ -52,6 +55,86 @@ struct FInteractionTraceDataV2
 	};
 };
 
+/**
+ * Candidates gathered by Cone Trace stored as Structure of Arrays.
+ * Arrays are padded to multiple of 4 so scoring can process them using vector registers.
+ */
+struct FInteractionConeCandidates
+{
+	TArray<float> LocationX;
+	TArray<float> LocationY;
+	TArray<float> LocationZ;
+	TArray<float> Weight;
+	TArray<float> Score;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Components;
+	TArray<int32> Items;
+	
+	int32 Num() const
+	{ return Components.Num(); };
+
+	void Reset()
+	{
+		LocationX.Reset();
+		LocationY.Reset();
+		LocationZ.Reset();
+		Weight.Reset();
+		Score.Reset();
+		Components.Reset();
+		Items.Reset();
+	};
+
+	void Add(UPrimitiveComponent* Component, const FVector& Location, const float CandidateWeight, const int32 Item = INDEX_NONE)
+	{
+		Components.Add(Component);
+		Items.Add(Item);
+		LocationX.Add(Location.X);
+		LocationY.Add(Location.Y);
+		LocationZ.Add(Location.Z);
+		Weight.Add(CandidateWeight);
+	};
+
+	/**
+	 * Pads arrays to multiple of 4 with neutral values.
+	 */
+	void Pad()
+	{
+		const int32 paddedNum = Align(Num(), 4);
+		LocationX.SetNumZeroed(paddedNum);
+		LocationY.SetNumZeroed(paddedNum);
+		LocationZ.SetNumZeroed(paddedNum);
+		Weight.SetNumZeroed(paddedNum);
+		Score.SetNumZeroed(paddedNum);
+	};
+};
+
+/**
+ * Snapshot of the last full Trace.
+ * Used to decide whether next Trace can be skipped because nothing relevant has changed.
+ */
+struct FInteractionTraceCoherence
+{
+	FVector StartLocation = FVector::ZeroVector;
+	FQuat TraceRotation = FQuat::Identity;
+	ETraceType TraceType = ETraceType::Default;
+	float TraceRange = 0.f;
+	TWeakObjectPtr<UObject> ActiveInteractable;
+	EInteractableStateV2 InteractableState = EInteractableStateV2::Default;
+	int32 InteractableWeight = INDEX_NONE;
+	int32 HitItem = INDEX_NONE;
+	int32 SkippedTraces = 0;
+	uint8 bIsValid : 1;
+
+	FInteractionTraceCoherence() : bIsValid(false)
+	{};
+
+	void Invalidate()
+	{
+		bIsValid = false;
+		ActiveInteractable.Reset();
+		SkippedTraces = 0;
+	};
+};
+
 #pragma region TracingData
 USTRUCT(BlueprintType)
 struct FTracingData
@@ -273,6 +356,13 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactor")
 	virtual FTransform GetCustomTraceStart() const;
 
+	/**
+	 * Returns ratio of Traces skipped thanks to Temporal Coherence to all processed Traces.
+	 * Value in range 0 - 1.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Interactor")
+	virtual float GetTraceSkipRate() const;
+
 protected:
 	
 	/**
@@ -283,6 +373,38 @@ protected:
 	virtual void ProcessTrace_Implementation();
 	virtual void ProcessTrace_Precise(FInteractionTraceDataV2& InteractionTraceData);
 	virtual void ProcessTrace_Loose(FInteractionTraceDataV2& InteractionTraceData);
+	virtual void ProcessTrace_Cone(FInteractionTraceDataV2& InteractionTraceData);
+
+	/**
+	 * Scores all Cone candidates.
+	 * Candidates outside of the cone or range are scored with lowest possible value.
+	 */
+	virtual void ScoreConeCandidates(FInteractionConeCandidates& Candidates, const FInteractionTraceDataV2& InteractionTraceData);
+
+	/**
+	 * Temporal coherence fast path.
+	 * If the trace start moved less than thresholds and Active Interactable has not changed its State nor Weight, full Trace is not needed.
+	 * Optionally verifies the Active Interactable is still hit using cheap single component Line Trace.
+	 *
+	 * @param InteractionTraceData	Trace data of the current Trace.
+	 * @return True if full Trace can be skipped.
+	 */
+	virtual bool CanSkipTrace(const FInteractionTraceDataV2& InteractionTraceData);
+	/**
+	 * Stores current Trace and Active Interactable as a reference for following Traces.
+	 */
+	virtual void UpdateTraceCoherence(const FInteractionTraceDataV2& InteractionTraceData);
+
+	/**
+	 * Lag compensation for remote Clients.
+	 * Validates given Interactable against the Trace as the Client has seen it, at Validation Time.
+	 * Trace is transformed into the rewound frame of the Interactable instead of moving Collision Components back.
+	 *
+	 * @param Interactable			Interactable the Client is interacting with.
+	 * @param InteractionTraceData	Trace data of the current Trace.
+	 * @return True if Interactable was hit at Validation Time.
+	 */
+	virtual bool ValidateRewoundInteractable(const TScriptInterface<IActorInteractableInterface>& Interactable, const FInteractionTraceDataV2& InteractionTraceData);
 	
 	/**
 	 * Function called after Trace has finished.
@@ -306,7 +428,7 @@ protected:
 	void ResumeTracing_Server();
 	
 	UFUNCTION(Server, Reliable)
-	void ProcessTrace_Server();
+	void ProcessTrace_Server(const float ViewTime);
 
 	UFUNCTION(Server, Unreliable)
 	void SetTraceType_Server(const ETraceType& NewTraceType);
@@ -375,6 +497,30 @@ protected:
 	 */
 	UPROPERTY(Replicated, EditAnywhere, Category="MounteaInteraction|Required", meta=(Units = "cm", UIMin=0.1f, ClampMin=0.1f))
 	float																					TraceShapeHalfSize = 5.0f;
+
+	/**
+	 * Half angle of the view cone used by Cone Tracing.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Cone", meta=(Units = "deg", UIMin=0.1f, ClampMin=0.1f, UIMax=89.f, ClampMax=89.f, EditCondition="TraceType==ETraceType::ETT_Cone"))
+	float																					ConeHalfAngle;
+
+	/**
+	 * How much being close to the view axis contributes to the candidate score.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Cone", meta=(UIMin=0, ClampMin=0, EditCondition="TraceType==ETraceType::ETT_Cone"))
+	float																					ConeAngleScale;
+
+	/**
+	 * How much being close to the Interactor contributes to the candidate score.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Cone", meta=(UIMin=0, ClampMin=0, EditCondition="TraceType==ETraceType::ETT_Cone"))
+	float																					ConeDistanceScale;
+
+	/**
+	 * How much Interactable Weight contributes to the candidate score.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Cone", meta=(UIMin=0, ClampMin=0, EditCondition="TraceType==ETraceType::ETT_Cone"))
+	float																					ConeWeightScale;
 	
 	/**
 	 * Defines whether Tracing starts at ActorEyesViewPoint (default) or at a given Location.
@@ -393,6 +539,39 @@ protected:
 	UPROPERTY(Replicated, VisibleAnywhere, Category="MounteaInteraction|Read Only", AdvancedDisplay, meta=(DisplayName="Trace Start (World Space Transform)"))
 	FTransform																		CustomTraceTransform;
 
+	/**
+	 * Optimization feature.
+	 * If enabled, full Trace is skipped while the view is steady and Active Interactable has not changed.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optimization")
+	uint8																				bUseTemporalCoherence : 1;
+
+	/**
+	 * Distance the Trace start can move while still being considered steady.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optimization", meta=(Units = "cm", UIMin=0, ClampMin=0, EditCondition="bUseTemporalCoherence"))
+	float																					CoherenceLinearThreshold;
+
+	/**
+	 * Angle the Trace direction can rotate while still being considered steady.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optimization", meta=(Units = "deg", UIMin=0, ClampMin=0, EditCondition="bUseTemporalCoherence"))
+	float																					CoherenceAngularThreshold;
+
+	/**
+	 * If enabled, skipped Trace is replaced with a cheap Line Trace against Active Interactable Collision Components only.
+	 * If disabled, skipped Trace does no collision queries at all.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optimization", meta=(EditCondition="bUseTemporalCoherence"))
+	uint8																				bVerifyActiveInteractable : 1;
+
+	/**
+	 * How many Traces in a row can be skipped before full Trace is forced.
+	 * Full Trace is needed to find Interactables which appeared in the view without camera movement.
+	 */
+	UPROPERTY(EditAnywhere, Category="MounteaInteraction|Optimization", meta=(UIMin=0, ClampMin=0, EditCondition="bUseTemporalCoherence"))
+	int32																					MaxSkippedTraces;
+
 	/**
 	 * Structure of all Tracing Data at one place.
 	 * Updated every time any value is changed.
@@ -407,6 +586,15 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category="MounteaInteraction|Read Only")
 	FTimerHandle																	Timer_Ticking;
 
+private:
+
+	FInteractionTraceCoherence													TraceCoherence;
+
+	FInteractionConeCandidates													ConeCandidates;
+
+	uint32																				ProcessedTracesCount = 0;
+	uint32																				SkippedTracesCount = 0;
+
 #pragma endregion
 
 #pragma region Events
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
+#include "GameplayTagContainer.h"
 
 #include "ActorInteractionPluginSettings.generated.h"
 
@@ -49,6 +51,38 @@ public:
 	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Input")
 	TSoftObjectPtr<UInputMappingContext>		InteractionInputMapping;
 
+	/** Defines how far back Server rewinds moving Interactables when validating Client targets. 0 disables Lag Compensation.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking", meta=(Units="s", UIMin=0, ClampMin=0, UIMax=1, ClampMax=1))
+	float																LagCompensationMaxRewindTime =		0.4f;
+
+	/** Defines maximum Transform samples stored per moving Interactable. Bounds Lag Compensation memory to roughly 40 B per sample.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking", meta=(UIMin=2, ClampMin=2, UIMax=64, ClampMax=64))
+	int32																LagCompensationMaxSamples =				16;
+
+	/** Defines how long Clients gather repeated Interaction starts, such as Mash Key presses, before sending them to Server in single call. 0 disables batching.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking", meta=(Units="s", UIMin=0, ClampMin=0, UIMax=0.5, ClampMax=0.5))
+	float																InteractionStartBatchWindow =		0.1f;
+
+	/** Defines how many Interaction starts per second Server accepts from single Interactor. Batched starts above this rate, e.g. forged Mash Key counts, are dropped.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Networking", meta=(Units="Hz", UIMin=1, ClampMin=1, UIMax=60, ClampMax=60))
+	float																MaxInteractionStartRate =				20.f;
+
+	/** Defines whether bound Interactable Collision Shapes get Interactable Object Type, so Trace Interactors query only them instead of every body on their Collision Channel. Occlusion is then checked by Safety Trace only.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Tracing")
+	uint8															bFilterTracesByObjectType : 1;
+
+	/** Defines Object Type of bound Interactable Collision Shapes. Use dedicated Object Channel, other bodies respond to Collision Shapes by their response to it.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Tracing", meta=(EditCondition="bFilterTracesByObjectType"))
+	TEnumAsByte<ECollisionChannel>				InteractableObjectType;
+
+	/** Defines root of Interaction Tags. Its subtree is precomputed into bitsets, so Interactor Tags are matched against Compatible Tags by single bit test. Tags outside of it still work, only slower.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Tags")
+	FGameplayTag												InteractionTagsRoot;
+
+	/** Defines how long Interactables may spend per frame on setup deferred from BeginPlay, so streamed World Partition cells do not initialize all at once. Interactables closest to local Interactors go first. Opt-in, 0 initializes Interactables in their BeginPlay.*/
+	UPROPERTY(config, BlueprintReadOnly, EditAnywhere, Category = "Streaming", meta=(Units="ms", UIMin=0, ClampMin=0, UIMax=16, ClampMax=16))
+	float																InteractableInitializationBudget =	0.f;
+
 	/** Defines default Interaction Commands. Serves purpose of containing default commands. */
 	TSet<FString>												InteractionWidgetCommands;
 	
@@ -67,6 +101,8 @@ public:
 	{
 		return "Project";
 	}
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 	
 public:
@@ -77,6 +113,30 @@ public:
 	float GetWidgetUpdateFrequency() const
 	{ return WidgetUpdateFrequency; }
 
+	float GetLagCompensationMaxRewindTime() const
+	{ return LagCompensationMaxRewindTime; };
+
+	int32 GetLagCompensationMaxSamples() const
+	{ return LagCompensationMaxSamples; };
+
+	float GetInteractionStartBatchWindow() const
+	{ return InteractionStartBatchWindow; };
+
+	float GetMaxInteractionStartRate() const
+	{ return MaxInteractionStartRate; };
+
+	/**
+	 * Returns Object Type Trace Interactors query, ECC_MAX if Traces are not filtered by Object Type.
+	 */
+	ECollisionChannel GetInteractableObjectType() const
+	{ return bFilterTracesByObjectType ? InteractableObjectType.GetValue() : ECC_MAX; };
+
+	FGameplayTag GetInteractionTagsRoot() const
+	{ return InteractionTagsRoot; };
+
+	float GetInteractableInitializationBudget() const
+	{ return InteractableInitializationBudget; };
+
 	TSoftObjectPtr<UDataTable> GetInteractableDefaultDataTable() const
 	{ return InteractableDefaultDataTable; };
 
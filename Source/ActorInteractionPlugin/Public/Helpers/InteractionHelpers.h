@@ -94,12 +94,14 @@ struct FCollisionShapeCache
   bGenerateOverlapEvents = false;
   CollisionEnabled = ECollisionEnabled::QueryOnly;
   CollisionResponse = ECR_Overlap;
+  ObjectType = ECC_WorldDynamic;
  };
 	
- FCollisionShapeCache(bool GeneratesOverlaps, TEnumAsByte<ECollisionEnabled::Type> collisionEnabled, TEnumAsByte<ECollisionResponse> collisionResponse) :
+ FCollisionShapeCache(bool GeneratesOverlaps, TEnumAsByte<ECollisionEnabled::Type> collisionEnabled, TEnumAsByte<ECollisionResponse> collisionResponse, TEnumAsByte<ECollisionChannel> objectType = ECC_WorldDynamic) :
  bGenerateOverlapEvents(GeneratesOverlaps),
   CollisionEnabled(collisionEnabled),
-  CollisionResponse(collisionResponse)
+  CollisionResponse(collisionResponse),
+  ObjectType(objectType)
  {};
 	
  UPROPERTY(Category="MounteaInteraction|Collision Cache", VisibleAnywhere)
@@ -108,7 +110,22 @@ struct FCollisionShapeCache
  TEnumAsByte<ECollisionEnabled::Type> CollisionEnabled;
  UPROPERTY(Category="MounteaInteraction|Collision Cache", VisibleAnywhere)
  TEnumAsByte<ECollisionResponse> CollisionResponse;
-	
+ UPROPERTY(Category="MounteaInteraction|Collision Cache", VisibleAnywhere)
+ TEnumAsByte<ECollisionChannel> ObjectType;
+};
+
+/**
+ * Runtime binding state of Collision Shape.
+ * Kept apart from saved `FCollisionShapeCache`, so it never ends up in SaveGame data.
+ */
+struct FCollisionShapeBinding
+{
+ /** Overlap delegates are bound once for Collision Shape lifetime. */
+ bool bDelegatesBound = false;
+ /** Requested query participation. */
+ bool bQueryActive = false;
+ /** Query participation currently applied to physics body. */
+ bool bQueryApplied = false;
 };
 
 #pragma endregion
@@ -0,0 +1,240 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InteractionHelpers.h"
+#include "MounteaInteractionTagBits.h"
+#include "Engine/DataAsset.h"
+#include "UObject/ObjectKey.h"
+#include "MounteaInteractableArchetype.generated.h"
+
+class UMaterialInterface;
+
+struct FStreamableHandle;
+
+/**
+ * Rarely changing Interactable configuration.
+ *
+ * Stored once per Archetype and shared by every Interactable pointing to it.
+ * Interactables only own a copy of this structure once any value is changed on them (copy-on-write).
+ */
+USTRUCT(BlueprintType)
+struct ACTORINTERACTIONPLUGIN_API FInteractableArchetypeSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Defines how long does Interaction take.
+	 * - -1 = immediate
+	 * - 0  = 0.1s
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Required", meta=(UIMin=-1, ClampMin=-1, Units="seconds", NoResetToDefault))
+	float																													InteractionPeriod;
+
+	/**
+	 * How long it takes for Cooldown to finish.
+	 * After this period of time the Interactable will be Awake again, unless no Interactor.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Required", meta=(NoResetToDefault, EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=0.1, ClampMin=0.1, Units="Seconds"))
+	float																													CooldownPeriod;
+
+	/**
+	 * Defines Lifecycle Mode of the Interactable.
+	 * Cycled:
+	 * * Can be used multiple times
+	 * * Good for NPCs
+	 * Once:
+	 * * Can be used only once
+	 * * Good for pickup items
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Required", meta=(NoResetToDefault))
+	EInteractableLifecycle																						LifecycleMode;
+
+	/**
+	 * How many times the Interactable can be used.
+	 * Expected range:
+	 * * -1 | Can be used forever
+	 * *  0 | Invalid, will be set to 2
+	 * *  1 | Invalid, will be set to 2
+	 * * 2+ | Will be used defined number of times
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Required", meta=(NoResetToDefault, EditCondition = "LifecycleMode == EInteractableLifecycle::EIL_Cycled", UIMin=-1, ClampMin=-1, Units="times"))
+	int32																												LifecycleCount;
+
+	/**
+	 * Tags which are compatible with this Interactable.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	FGameplayTagContainer																					InteractableCompatibleTags;
+
+	/**
+	 * List of Interactor Classes which are ignored.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(NoResetToDefault, AllowAbstract=false, MustImplement="/Script/ActorInteractionPlugin.ActorInteractorInterface", BlueprintBaseOnly))
+	TArray<TSoftClassPtr<UObject>>																	IgnoredClasses;
+
+	/**
+	 * Expects: Actor Tags
+	 * List of Actor Tags which define which Primitive Components should be added to Collision Shapes.
+	 *
+	 * Is used even with Auto Setup.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	TArray<FName>																								CollisionOverrides;
+
+	/**
+	 * Expects: Actor Tags
+	 * List of Actor Tags which define which Mesh Components should be added to Highlightable Meshes.
+	 *
+	 * Is used even with Auto Setup.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	TArray<FName>																								HighlightableOverrides;
+
+	/**
+	 * Defines what Highlight Type is used.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional")
+	EHighlightType																									HighlightType;
+
+	/**
+	 * Defines whether Interactable should be highlighted when Interaction is possible.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional")
+	uint8																												bInteractionHighlight : 1;
+
+	/**
+	 * Defines whether Interaction progress is kept once Interaction is stopped.
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional")
+	uint8																												bCanPersist : 1;
+
+	/**
+	 * Defines what Stencil ID should be used to highlight the Primitive Mesh Components.
+	 * Default: 133
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true", UIMin=0, ClampMin=0, UIMax=255, ClampMax=255))
+	int32																												StencilID;
+
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(EditCondition="bInteractionHighlight==true"))
+	TObjectPtr<UMaterialInterface>																		HighlightMaterial;
+
+	/**
+	 * Provides a simple way to determine how fast Interaction Progress is kept before interaction is cancelled.
+	 * * -1 means never while Interactor is valid
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(UIMin=-1.f, ClampMin=-1.f, EditCondition="bCanPersist!=false"))
+	float																													InteractionProgressExpiration;
+
+	/**
+	 * TODO
+	 * Defines behaviour of TimeToStart.
+	 * Currently has no logic tied to it!
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(NoResetToDefault))
+	ETimingComparison																							ComparisonMethod;
+
+	/**
+	 * TODO
+	 * Time in seconds it is required to start this interaction.
+	 * Currently has no logic tied to it!
+	 */
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Optional", meta=(UIMin=0.001, ClampMin=0.001, Units="seconds", EditCondition="ComparisonMethod!=ETimingComparison::ECM_None", NoResetToDefault))
+	float																													TimeToStart;
+
+	/**
+	 * If active, debug can be drawn.
+	 * Does not affect Shipping builds by default C++ implementation.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="MounteaInteraction|Debug", meta=(ShowOnlyInnerProperties))
+	FDebugSettings																								DebugSettings;
+
+	FInteractableArchetypeSettings();
+
+	/**
+	 * Clamps values into ranges expected by Interactables.
+	 */
+	void Sanitize();
+};
+
+/**
+ * Shared, immutable Interactable configuration.
+ *
+ * Interactables keep only a pointer to an Archetype. Values changed on a single Interactable at runtime
+ * or in the Details panel are stored in its own Archetype Override, leaving the shared Archetype untouched.
+ */
+UCLASS(ClassGroup=(Mountea), BlueprintType, EditInlineNew, meta = (DisplayName = "Mountea Interactable Archetype"), autoexpandcategories=("MounteaInteraction|Required","MounteaInteraction|Optional"))
+class ACTORINTERACTIONPLUGIN_API UMounteaInteractableArchetype : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Replicated only for Archetype Overrides, which their Interactable registers as replicated SubObjects.
+	 * Shared Archetype assets are never registered, Clients load them by reference and Settings never change at runtime.
+	 */
+	UPROPERTY(Replicated, SaveGame, EditAnywhere, BlueprintReadOnly, Category="Archetype", meta=(ShowOnlyInnerProperties))
+	FInteractableArchetypeSettings																		Settings;
+
+public:
+
+	virtual bool IsSupportedForNetworking() const override
+	{ return true; };
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PostRepNotifies() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/**
+	 * Returns Compatible Tags as bitset, computed on first use after they have changed.
+	 */
+	const FMounteaInteractionTagBits& GetCompatibleTagBits() const;
+
+	/**
+	 * Call after Compatible Tags have been changed, so their bitset is computed again.
+	 */
+	void MarkCompatibleTagsDirty()
+	{ bCompatibleTagBitsDirty = true; };
+
+	/**
+	 * Returns whether Interactors of given Class are ignored.
+	 * Result is cached per Interactor Class until Ignored Classes change, so repeated checks cost single lookup.
+	 */
+	bool IsInteractorClassIgnored(const UClass* InteractorClass) const;
+
+	/**
+	 * Call after Ignored Classes have been changed, so they are resolved again.
+	 */
+	void MarkIgnoredClassesDirty()
+	{ bIgnoredClassesDirty = true; bIgnoredClassesLoadRequested = false; };
+
+	/**
+	 * Makes every Archetype resolve its Ignored Classes again, e.g. after Blueprint Classes were reinstanced.
+	 */
+	static void InvalidateResolvedClasses();
+
+protected:
+
+	/**
+	 * Resolves loaded Ignored Classes and starts async load of the rest.
+	 * Classes which are not loaded cannot have any Interactor yet, they are resolved again once loaded.
+	 * Before Asset Manager is initialized, they are resolved again on next query.
+	 */
+	void ResolveIgnoredClasses() const;
+
+	mutable FMounteaInteractionTagBits																	CompatibleTagBits;
+	mutable bool																									bCompatibleTagBitsDirty = true;
+
+	mutable TSet<TObjectKey<UClass>>																ResolvedIgnoredClasses;
+	mutable TMap<TObjectKey<UClass>, bool>															IgnoredClassResults;
+	mutable TSharedPtr<FStreamableHandle>															IgnoredClassesHandle;
+	mutable uint32																								ResolvedClassesGeneration = 0;
+	mutable bool																									bIgnoredClassesDirty = true;
+	mutable bool																									bIgnoredClassesLoadRequested = false;
+};
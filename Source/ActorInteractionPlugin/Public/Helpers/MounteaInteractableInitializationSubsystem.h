@@ -0,0 +1,74 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaInteractableInitializationSubsystem.generated.h"
+
+class UActorComponent;
+
+/**
+ * Budgeted queue of Interactable setup deferred from BeginPlay.
+ *
+ * Streamed World Partition cells begin play for hundreds of Interactables in the same frame.
+ * Their Auto Setup, input device binding and Default State are queued here and run within `InteractableInitializationBudget` per frame instead.
+ * Interactables closest to local Interactors go first, on Server every Interactor is local.
+ * Accepts both Widget and Widgetless Interactable Components.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UMounteaInteractableInitializationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Queues Interactable for initialization.
+	 * Interactable is initialized immediately if budget is 0 or its World has no queue, e.g. Editor preview.
+	 */
+	static void RequestInitialization(UActorComponent* Interactable);
+
+	/**
+	 * Initializes Interactable now if it is still queued.
+	 */
+	static void InitializeImmediately(UActorComponent* Interactable);
+
+	static void CancelInitialization(UActorComponent* Interactable);
+
+	/**
+	 * Initializes every queued Interactable regardless of budget, e.g. behind loading screen.
+	 */
+	void Flush();
+
+	int32 GetQueuedCount() const
+	{ return Queue.Num(); };
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * Orders queue by distance to closest local Interactor, keeps queue order if there is none.
+	 * Queue is sorted again only after new Interactables were queued.
+	 */
+	void SortQueue();
+	void GatherInteractorLocations(TArray<FVector>& OutLocations) const;
+
+	static void InitializeQueued(UActorComponent* Interactable);
+
+protected:
+
+	struct FQueuedInteractable
+	{
+		TWeakObjectPtr<UActorComponent> Interactable;
+		double Priority = 0.0;
+	};
+
+	TArray<FQueuedInteractable>																		Queue;
+	bool																												bQueueSorted = true;
+};
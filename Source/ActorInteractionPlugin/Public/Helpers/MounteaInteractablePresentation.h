@@ -0,0 +1,119 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ScriptInterface.h"
+#include "MounteaInteractablePresentation.generated.h"
+
+class IActorInteractorInterface;
+
+/**
+ * Cosmetic and lifecycle flags of Interactable as presented to Clients.
+ * Flags describe current presentation, events are derived from their changes.
+ */
+enum class EInteractablePresentationFlags : uint8
+{
+	EIPF_None						= 0,
+
+	EIPF_Highlighted				= 1 << 0,
+	EIPF_WidgetVisible			= 1 << 1,
+	EIPF_InteractorFound		= 1 << 2,
+	EIPF_InteractionActive		= 1 << 3,
+	EIPF_InteractionPaused		= 1 << 4,		// Interaction was stopped and can be resumed
+	EIPF_InteractionCanceled	= 1 << 5,		// Latest Interaction was canceled, cleared by next start
+
+	EIPF_Interaction = EIPF_InteractionActive | EIPF_InteractionPaused | EIPF_InteractionCanceled
+};
+ENUM_CLASS_FLAGS(EInteractablePresentationFlags)
+
+/**
+ * Replicated presentation state of Interactable.
+ *
+ * Replaces separate cosmetic Client RPCs with single push-model property.
+ * Clients diff it against previously applied state in one OnRep and dispatch events locally.
+ * Interaction Progress is replicated as Server start time, period and pause time, Clients reconstruct it from Server World time.
+ */
+USTRUCT()
+struct FInteractablePresentationState
+{
+	GENERATED_BODY()
+
+	/**
+	 * `EInteractablePresentationFlags` bitfield.
+	 */
+	UPROPERTY()
+	uint8																											Flags = 0;
+
+	/**
+	 * Increased on every Interaction start, so quick restarts between net updates are not lost.
+	 */
+	UPROPERTY()
+	uint8																											InteractionSerial = 0;
+
+	/**
+	 * Server World time when Interaction Progress was 0.
+	 * Resumed Interactions are shifted by progress made before pause.
+	 */
+	UPROPERTY()
+	float																											ServerStartTime = 0.f;
+
+	/**
+	 * Period of running Interaction.
+	 */
+	UPROPERTY()
+	float																											InteractionPeriod = 0.f;
+
+	/**
+	 * Server World time when Interaction was paused. -1 if not paused.
+	 */
+	UPROPERTY()
+	float																											PausedAt = -1.f;
+
+	/**
+	 * Interactor the presentation belongs to.
+	 */
+	UPROPERTY()
+	TScriptInterface<IActorInteractorInterface>												Interactor = nullptr;
+
+	EInteractablePresentationFlags GetFlags() const
+	{ return static_cast<EInteractablePresentationFlags>(Flags); };
+
+	bool HasFlags(const EInteractablePresentationFlags InFlags) const
+	{ return EnumHasAllFlags(GetFlags(), InFlags); };
+
+	/**
+	 * Reconstructs Interaction Progress at given Server World time, 0 to 1.
+	 * No timer is involved, so it can be polled every frame.
+	 */
+	float GetProgress(const float ServerTime) const
+	{
+		if (InteractionPeriod <= 0.f) return 0.f;
+
+		float elapsedTime = 0.f;
+		if (HasFlags(EInteractablePresentationFlags::EIPF_InteractionActive))
+			elapsedTime = ServerTime - ServerStartTime;
+		else if (HasFlags(EInteractablePresentationFlags::EIPF_InteractionPaused) && PausedAt >= 0.f)
+			elapsedTime = PausedAt - ServerStartTime;
+
+		return FMath::Clamp(elapsedTime / InteractionPeriod, 0.f, 1.f);
+	};
+
+	/**
+	 * Number of steps Interaction Progress is split into when deciding whether continued Interaction needs net update.
+	 */
+	static constexpr int32 ProgressBuckets = 100;
+
+	int32 GetProgressBucket(const float ServerTime) const
+	{ return FMath::FloorToInt32(GetProgress(ServerTime) * ProgressBuckets); };
+
+	/**
+	 * Returns whether any Flag has changed.
+	 */
+	bool SetFlags(const EInteractablePresentationFlags InFlags, const bool bEnabled)
+	{
+		const uint8 previousFlags = Flags;
+		Flags = bEnabled ? (Flags | static_cast<uint8>(InFlags)) : (Flags & ~static_cast<uint8>(InFlags));
+		return Flags != previousFlags;
+	};
+};
@@ -0,0 +1,42 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MounteaInteractableProviderSubsystem.generated.h"
+
+class IActorInteractorInterface;
+
+/**
+ * Provider of Interactables which are not backed by Interactable Components all the time, e.g. Mass Entities.
+ *
+ * Interactors ask every Provider in World to promote Interactables close to their queries.
+ * Promoted Interactables are regular Interactable Components with Collision Shapes, so regular Trace and Overlap flow finds them.
+ * Providers are responsible for demoting them again once no Interactor is engaged.
+ */
+UCLASS(Abstract)
+class ACTORINTERACTIONPLUGIN_API UMounteaInteractableProviderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Promotes Interactables within Radius of segment Start-End.
+	 * Called on Server only.
+	 */
+	virtual void PromoteInteractables(const FVector& Start, const FVector& End, const float Radius, const TScriptInterface<IActorInteractorInterface>& Interactor)
+	{};
+
+	/**
+	 * Asks every Provider in World to promote Interactables within Radius of segment Start-End.
+	 * Use Start == End for spherical queries.
+	 */
+	static void RequestPromotion(const UWorld* World, const FVector& Start, const FVector& End, const float Radius, const TScriptInterface<IActorInteractorInterface>& Interactor);
+
+	/**
+	 * Returns whether World contains any Provider.
+	 */
+	static bool HasProviders(const UWorld* World);
+};
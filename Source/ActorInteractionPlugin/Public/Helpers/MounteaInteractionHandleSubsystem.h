@@ -0,0 +1,90 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Helpers/MounteaInteractionNetTypes.h"
+#include "MounteaInteractionHandleSubsystem.generated.h"
+
+/**
+ * Registry of Interaction Handles in World.
+ *
+ * Server allocates Handles for Interactables and Interactors once they begin play and releases them once they end play.
+ * Handles are replicated with their components, Clients bind the same Handle to their local copy.
+ * Released indices are reused with increased Serial, so stale Handles resolve to nothing.
+ * Up to `FMounteaInteractionHandle::MaxIndex` + 1 Objects can be registered at once.
+ */
+UCLASS()
+class ACTORINTERACTIONPLUGIN_API UMounteaInteractionHandleSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Allocates Handle for given Object. Returns existing Handle if Object is already registered.
+	 * Called on Server only.
+	 */
+	FMounteaInteractionHandle RegisterObject(UObject* Object);
+
+	/**
+	 * Binds Handle received from Server to local Object.
+	 * Called on Clients only.
+	 */
+	void BindHandle(const FMounteaInteractionHandle& Handle, UObject* Object);
+
+	/**
+	 * Releases Handle, so its index can be reused.
+	 */
+	void ReleaseHandle(const FMounteaInteractionHandle& Handle);
+
+	UObject* ResolveHandle(const FMounteaInteractionHandle& Handle) const;
+	FMounteaInteractionHandle FindHandle(const UObject* Object) const;
+
+	/**
+	 * Calls Function for every registered Object.
+	 */
+	template<typename FunctionType>
+	void ForEachObject(FunctionType&& Function) const
+	{
+		for (const FHandleEntry& handleEntry : Entries)
+		{
+			if (UObject* registeredObject = handleEntry.Object.Get())
+			{
+				Function(registeredObject);
+			}
+		}
+	};
+
+	/**
+	 * Returns Handle of given Object, invalid Handle if Object is not registered in its World.
+	 */
+	static FMounteaInteractionHandle GetHandle(const UObject* Object);
+
+	/**
+	 * Resolves Handle to Interface in given World, null if Handle is stale or Object does not implement it.
+	 */
+	template<typename InterfaceType>
+	static TScriptInterface<InterfaceType> Resolve(const UWorld* World, const FMounteaInteractionHandle& Handle)
+	{
+		const UMounteaInteractionHandleSubsystem* handleSubsystem = World ? World->GetSubsystem<UMounteaInteractionHandleSubsystem>() : nullptr;
+		UObject* resolvedObject = handleSubsystem ? handleSubsystem->ResolveHandle(Handle) : nullptr;
+
+		return resolvedObject && resolvedObject->Implements<typename InterfaceType::UClassType>() ? TScriptInterface<InterfaceType>(resolvedObject) : TScriptInterface<InterfaceType>();
+	};
+
+protected:
+
+	struct FHandleEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+		uint32 Serial = 0;
+	};
+
+	TArray<FHandleEntry>																				Entries;
+	TArray<uint32>																							FreeIndices;
+	TMap<TObjectKey<UObject>, FMounteaInteractionHandle>									ObjectHandles;
+};
@@ -0,0 +1,95 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MounteaInteractionNetTypes.generated.h"
+
+/**
+ * Net-stable handle of Interactable or Interactor.
+ *
+ * Index into `UMounteaInteractionHandleSubsystem` registry in lower 20 bits, reuse Serial in upper 12 bits.
+ * Server assigns handles, Clients receive them with the component and register the same mapping.
+ * RPCs carry handles instead of object references, serialized as two packed integers, 7 bits per byte.
+ * Index takes 1 byte below 128 registered objects, 2 bytes below 16384 and 3 bytes above. Serial takes 1 byte until its index is reused 128 times, 2 bytes after.
+ */
+USTRUCT(BlueprintType)
+struct ACTORINTERACTIONPLUGIN_API FMounteaInteractionHandle
+{
+	GENERATED_BODY()
+
+	FMounteaInteractionHandle()
+	{};
+
+	static constexpr uint32 IndexBits = 20;
+	static constexpr uint32 MaxIndex = (1u << IndexBits) - 1;
+	static constexpr uint32 MaxSerial = (1u << (32 - IndexBits)) - 1;
+
+	FMounteaInteractionHandle(const uint32 Index, const uint32 Serial)
+		: Value(((Serial & MaxSerial) << IndexBits) | (Index & MaxIndex))
+	{};
+
+	uint32 GetIndex() const
+	{ return Value & MaxIndex; };
+
+	uint32 GetSerial() const
+	{ return Value >> IndexBits; };
+
+	/**
+	 * Serial 0 is never assigned, so default handle is invalid.
+	 */
+	bool IsValid() const
+	{ return GetSerial() != 0; };
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint32 index = GetIndex();
+		uint32 serial = GetSerial();
+
+		Ar.SerializeIntPacked(index);
+		Ar.SerializeIntPacked(serial);
+
+		if (Ar.IsLoading())
+		{
+			// Out of range values never come from valid Handle
+			if (index > MaxIndex || serial > MaxSerial)
+			{
+				*this = FMounteaInteractionHandle();
+				bOutSuccess = false;
+				return true;
+			}
+
+			*this = FMounteaInteractionHandle(index, serial);
+		}
+
+		bOutSuccess = true;
+		return true;
+	};
+
+	bool operator==(const FMounteaInteractionHandle& Other) const
+	{ return Value == Other.Value; };
+
+	bool operator!=(const FMounteaInteractionHandle& Other) const
+	{ return Value != Other.Value; };
+
+	friend uint32 GetTypeHash(const FMounteaInteractionHandle& Handle)
+	{ return Handle.Value; };
+
+	FString ToString() const
+	{ return IsValid() ? FString::Printf(TEXT("%u:%u"), GetIndex(), GetSerial()) : TEXT("None"); };
+
+protected:
+
+	UPROPERTY()
+	uint32																										Value = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMounteaInteractionHandle> : public TStructOpsTypeTraitsBase2<FMounteaInteractionHandle>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
@@ -0,0 +1,64 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed capacity ring buffer of past Transforms.
+ *
+ * Used by Server to rewind moving Interactables to the time Client has seen them.
+ * Memory is allocated once in Initialize and never grows, oldest samples are overwritten.
+ * Samples are only added while Transform changes, resting Owners cost nothing.
+ */
+struct ACTORINTERACTIONPLUGIN_API FMounteaInteractionRewindBuffer
+{
+	/**
+	 * Allocates room for Capacity samples. Discards any existing samples.
+	 */
+	void Initialize(const int32 Capacity);
+
+	/**
+	 * Releases all memory.
+	 */
+	void Release();
+
+	/**
+	 * Adds sample at given Time.
+	 * Newest sample is replaced instead if it is closer than MinInterval to the one before, so newest sample always matches current Transform.
+	 */
+	void AddSample(const float Time, const FTransform& Transform, const float MinInterval = 0.f);
+
+	/**
+	 * Copies newest sample to given Time, marks Owner resting since newest sample until then.
+	 */
+	void HoldNewestSample(const float Time);
+
+	/**
+	 * Interpolates Transform at given Time.
+	 * Times older than the oldest sample are clamped to it. Returns false if there is no sample.
+	 */
+	bool GetTransformAt(const float Time, FTransform& OutTransform) const;
+
+	bool IsInitialized() const
+	{ return Samples.Num() > 0; };
+
+	SIZE_T GetAllocatedSize() const
+	{ return Samples.GetAllocatedSize(); };
+
+private:
+
+	struct FRewindSample
+	{
+		FVector Location = FVector::ZeroVector;
+		FQuat4f Rotation = FQuat4f::Identity;
+		float Time = 0.f;
+	};
+
+	const FRewindSample& GetSample(const int32 AgeIndex) const
+	{ return Samples[(Head - 1 - AgeIndex + Samples.Num()) % Samples.Num()]; };
+
+	TArray<FRewindSample> Samples;
+	int32 Head = 0;
+	int32 Count = 0;
+};
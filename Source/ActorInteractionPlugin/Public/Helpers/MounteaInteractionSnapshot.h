@@ -0,0 +1,64 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/InteractionHelpers.h"
+
+class UWorld;
+class ULevel;
+
+/**
+ * Mutable state of single Interactable as stored in Interaction Snapshot.
+ */
+struct ACTORINTERACTIONPLUGIN_API FMounteaInteractableSnapshotRecord
+{
+	/**
+	 * Stable ID of Interactable, see `UActorInteractableComponentBase::GetSnapshotId`.
+	 */
+	uint64																										Id = 0;
+
+	EInteractableStateV2																						State = EInteractableStateV2::EIS_Awake;
+	int32																											RemainingLifecycleCount = -1;
+	int32																											InteractionWeight = 0;
+
+	/**
+	 * Remaining Cooldown in seconds, 0 if Interactable is not cooling down.
+	 */
+	float																											RemainingCooldown = 0.f;
+
+	friend ACTORINTERACTIONPLUGIN_API FArchive& operator<<(FArchive& Ar, FMounteaInteractableSnapshotRecord& Record);
+};
+
+/**
+ * Compact versioned binary snapshot of Interactables in World.
+ *
+ * Replaces generic SaveGame reflection for save games and World Partition cell reloads.
+ * Records are keyed by stable ID and restored in one batch, directly into Interactables, bypassing State Machine and events.
+ * Running Interactions are not stored, Active and Paused Interactables are restored Awake without Interactor.
+ * Blob layout: Magic, Version, packed record count, records with optional values behind per-record field mask.
+ */
+struct ACTORINTERACTIONPLUGIN_API FMounteaInteractionSnapshot
+{
+	static constexpr uint32 Magic = 0x4D49534E;
+	static constexpr uint32 Version = 1;
+
+	static void WriteRecords(const TArray<FMounteaInteractableSnapshotRecord>& Records, TArray<uint8>& OutBlob);
+
+	/**
+	 * Returns false if Blob is not Interaction Snapshot or was written by newer version.
+	 */
+	static bool ReadRecords(const TArray<uint8>& Blob, TArray<FMounteaInteractableSnapshotRecord>& OutRecords);
+
+	/**
+	 * Captures every registered Interactable in World, optionally only those in given Level, e.g. World Partition cell.
+	 * Called on Server only. Returns number of captured Interactables.
+	 */
+	static int32 Capture(const UWorld* World, TArray<uint8>& OutBlob, const ULevel* Level = nullptr);
+
+	/**
+	 * Restores registered Interactables in World from Blob, records without matching Interactable are skipped.
+	 * Called on Server only. Returns number of restored Interactables, -1 if Blob is invalid.
+	 */
+	static int32 Restore(const UWorld* World, const TArray<uint8>& Blob);
+};
@@ -0,0 +1,251 @@
+// Copyright Dominik Morse (Pavlicek) 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/InteractionHelpers.h"
+
+/**
+ * Side effects of a single Interactable State transition.
+ * Effects are applied in declaration order by `ApplyStateTransitionEffects`.
+ * Upper bits are reserved for custom subclass effects.
+ */
+enum class EInteractableStateEffect : uint16
+{
+	ESE_None						= 0,
+	
+	ESE_CancelInteraction		= 1 << 0,		// Broadcasts OnInteractionCanceled before the State changes
+	ESE_Allowed					= 1 << 1,		// Transition is legal, State is changed
+	ESE_StopHighlight			= 1 << 2,
+	ESE_BroadcastState			= 1 << 3,
+	ESE_ClearTimers				= 1 << 4,		// Clears all Timers of the Interactable
+	ESE_ClearCooldown			= 1 << 5,
+	ESE_LoseInteractor			= 1 << 6,
+	ESE_UnbindCollision			= 1 << 7,
+	ESE_BindCollision			= 1 << 8,
+	ESE_Cleanup					= 1 << 9,
+
+	ESE_Custom0					= 1 << 12,
+	ESE_Custom1					= 1 << 13,
+	ESE_Custom2					= 1 << 14,
+	ESE_Custom3					= 1 << 15,
+
+	// Full cleanup used when Interactable leaves interaction completely
+	ESE_Shutdown = ESE_Allowed | ESE_StopHighlight | ESE_BroadcastState | ESE_ClearTimers | ESE_LoseInteractor | ESE_UnbindCollision
+};
+ENUM_CLASS_FLAGS(EInteractableStateEffect)
+
+/**
+ * Side effects of a single Interactor State transition.
+ */
+enum class EInteractorStateEffect : uint8
+{
+	ESE_None						= 0,
+	
+	ESE_Allowed					= 1 << 0,		// Transition is legal, State is changed
+	ESE_NotifyStateChanged		= 1 << 1,
+
+	ESE_Custom0					= 1 << 4,
+	ESE_Custom1					= 1 << 5,
+	ESE_Custom2					= 1 << 6,
+	ESE_Custom3					= 1 << 7,
+
+	ESE_Default = ESE_Allowed | ESE_NotifyStateChanged
+};
+ENUM_CLASS_FLAGS(EInteractorStateEffect)
+
+/**
+ * Compile time transition table.
+ * Effects[To][From] holds side effects of transition, `ESE_Allowed` bit marks legal transitions.
+ */
+template<typename TState, typename TEffect>
+struct TInteractionStateTable
+{
+	using FState = TState;
+	using FEffect = TEffect;
+	
+	static constexpr int32 NumStates = static_cast<int32>(TState::Default) + 1;
+	
+	TEffect Effects[NumStates][NumStates] = {};
+
+	/**
+	 * States can arrive from Clients or saved data, anything out of range is never valid.
+	 */
+	static constexpr bool IsValidState(const TState State)
+	{
+		return static_cast<uint32>(State) < static_cast<uint32>(NumStates);
+	}
+
+	constexpr TEffect GetEffects(const TState From, const TState To) const
+	{
+		if (!IsValidState(From) || !IsValidState(To)) return TEffect::ESE_None;
+		
+		return Effects[static_cast<int32>(To)][static_cast<int32>(From)];
+	}
+
+	constexpr bool IsAllowed(const TState From, const TState To) const
+	{
+		return EnumHasAnyFlags(GetEffects(From, To), TEffect::ESE_Allowed);
+	}
+
+	/**
+	 * Bitmask of States which can be reached from given State.
+	 */
+	constexpr uint32 GetAllowedTargets(const TState From) const
+	{
+		uint32 allowedTargets = 0;
+		if (!IsValidState(From)) return allowedTargets;
+		
+		for (int32 To = 0; To < NumStates; To++)
+		{
+			if (EnumHasAnyFlags(Effects[To][static_cast<int32>(From)], TEffect::ESE_Allowed))
+			{
+				allowedTargets |= 1u << To;
+			}
+		}
+		return allowedTargets;
+	}
+
+	template<typename... TFrom>
+	constexpr void AddEdges(const TState To, const TEffect EdgeEffects, const TFrom... From)
+	{
+		((Effects[static_cast<int32>(To)][static_cast<int32>(From)] |= EdgeEffects), ...);
+	}
+
+	constexpr void AddEdgesFromAll(const TState To, const TEffect EdgeEffects)
+	{
+		for (int32 From = 0; From < NumStates; From++)
+		{
+			Effects[static_cast<int32>(To)][From] |= EdgeEffects;
+		}
+	}
+};
+
+using FInteractableStateTable = TInteractionStateTable<EInteractableStateV2, EInteractableStateEffect>;
+using FInteractorStateTable = TInteractionStateTable<EInteractorStateV2, EInteractorStateEffect>;
+
+namespace MounteaInteractionStateMachine
+{
+	constexpr FInteractableStateTable MakeInteractableStateTable()
+	{
+		using EState = EInteractableStateV2;
+		using EEffect = EInteractableStateEffect;
+		
+		FInteractableStateTable table;
+
+		table.AddEdges(EState::EIS_Active,			EEffect::ESE_Allowed | EEffect::ESE_BroadcastState,
+			EState::EIS_Paused, EState::EIS_Awake);
+		
+		table.AddEdges(EState::EIS_Awake,			EEffect::ESE_Allowed | EEffect::ESE_BroadcastState | EEffect::ESE_BindCollision,
+			EState::EIS_Active, EState::EIS_Asleep, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled, EState::EIS_Paused);
+		
+		table.AddEdges(EState::EIS_Asleep,			EEffect::ESE_Shutdown,
+			EState::EIS_Active, EState::EIS_Paused, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Disabled);
+		
+		table.AddEdges(EState::EIS_Cooldown,		EEffect::ESE_Allowed | EEffect::ESE_StopHighlight | EEffect::ESE_BroadcastState,
+			EState::EIS_Awake, EState::EIS_Active);
+		table.AddEdges(EState::EIS_Cooldown,		EEffect::ESE_Shutdown,
+			EState::EIS_Suppressed, EState::EIS_Disabled);
+		
+		table.AddEdges(EState::EIS_Completed,		EEffect::ESE_Allowed | EEffect::ESE_Cleanup,
+			EState::EIS_Active);
+		
+		table.AddEdges(EState::EIS_Disabled,		EEffect::ESE_Shutdown,
+			EState::EIS_Active, EState::EIS_Paused, EState::EIS_Completed, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Cooldown, EState::EIS_Asleep);
+		
+		table.AddEdges(EState::EIS_Suppressed,	EEffect::ESE_CancelInteraction | EEffect::ESE_Allowed | EEffect::ESE_StopHighlight | EEffect::ESE_BroadcastState,
+			EState::EIS_Active, EState::EIS_Awake, EState::EIS_Asleep, EState::EIS_Disabled, EState::EIS_Paused);
+		table.AddEdges(EState::EIS_Suppressed,	EEffect::ESE_CancelInteraction | EEffect::ESE_Allowed | EEffect::ESE_StopHighlight | EEffect::ESE_BroadcastState | EEffect::ESE_ClearCooldown,
+			EState::EIS_Cooldown);
+		
+		table.AddEdges(EState::EIS_Paused,			EEffect::ESE_Allowed | EEffect::ESE_BroadcastState,
+			EState::EIS_Active);
+
+		// Requesting Default State only stops highlight
+		table.AddEdgesFromAll(EState::Default,		EEffect::ESE_StopHighlight);
+
+		return table;
+	}
+
+	constexpr FInteractorStateTable MakeInteractorStateTable()
+	{
+		using EState = EInteractorStateV2;
+		using EEffect = EInteractorStateEffect;
+		
+		FInteractorStateTable table;
+
+		table.AddEdges(EState::EIS_Awake,			EEffect::ESE_Default,
+			EState::EIS_Asleep, EState::EIS_Disabled, EState::EIS_Suppressed, EState::EIS_Active);
+		table.AddEdges(EState::EIS_Asleep,			EEffect::ESE_Default,
+			EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Active, EState::EIS_Disabled);
+		table.AddEdges(EState::EIS_Suppressed,	EEffect::ESE_Default,
+			EState::EIS_Awake, EState::EIS_Asleep, EState::EIS_Active);
+		table.AddEdges(EState::EIS_Active,			EEffect::ESE_Default,
+			EState::EIS_Awake);
+		table.AddEdges(EState::EIS_Disabled,		EEffect::ESE_Default,
+			EState::EIS_Asleep, EState::EIS_Awake, EState::EIS_Suppressed, EState::EIS_Active);
+
+		return table;
+	}
+
+	inline constexpr FInteractableStateTable InteractableStateTable = MakeInteractableStateTable();
+	inline constexpr FInteractorStateTable InteractorStateTable = MakeInteractorStateTable();
+
+#pragma region Validation
+
+	template<typename TTable>
+	constexpr bool HasNoSelfTransitions(const TTable& Table)
+	{
+		for (int32 State = 0; State < TTable::NumStates; State++)
+		{
+			if (EnumHasAnyFlags(Table.Effects[State][State], TTable::FEffect::ESE_Allowed))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename TTable>
+	constexpr bool IsUnreachable(const TTable& Table, const typename TTable::FState State)
+	{
+		for (int32 From = 0; From < TTable::NumStates; From++)
+		{
+			if (Table.IsAllowed(static_cast<typename TTable::FState>(From), State))
+				return false;
+		}
+		return true;
+	}
+
+	constexpr bool ValidateInteractableEffects(const FInteractableStateTable& Table)
+	{
+		using EEffect = EInteractableStateEffect;
+		
+		for (int32 To = 0; To < FInteractableStateTable::NumStates; To++)
+		{
+			for (int32 From = 0; From < FInteractableStateTable::NumStates; From++)
+			{
+				const EEffect effects = Table.Effects[To][From];
+
+				// Side effects of illegal transition are allowed only for Default request
+				if (!EnumHasAnyFlags(effects, EEffect::ESE_Allowed) && effects != EEffect::ESE_None && To != static_cast<int32>(EInteractableStateV2::Default))
+					return false;
+				
+				if (EnumHasAllFlags(effects, EEffect::ESE_BindCollision | EEffect::ESE_UnbindCollision))
+					return false;
+
+				// Completed is handled by Cleanup, any other State change must be broadcast
+				if (EnumHasAnyFlags(effects, EEffect::ESE_Allowed) && !EnumHasAnyFlags(effects, EEffect::ESE_BroadcastState | EEffect::ESE_Cleanup))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	static_assert(HasNoSelfTransitions(InteractableStateTable), "Interactable State table must not allow self transitions");
+	static_assert(HasNoSelfTransitions(InteractorStateTable), "Interactor State table must not allow self transitions");
+	static_assert(IsUnreachable(InteractableStateTable, EInteractableStateV2::Default), "Interactable Default State must not be reachable");
+	static_assert(IsUnreachable(InteractorStateTable, EInteractorStateV2::Default), "Interactor Default State must not be reachable");
+	static_assert(InteractableStateTable.GetAllowedTargets(EInteractableStateV2::EIS_Completed) == (1u << static_cast<int32>(EInteractableStateV2::EIS_Disabled)), "Completed Interactable can only be Disabled");
+	static_assert(ValidateInteractableEffects(InteractableStateTable), "Interactable State table contains invalid effects");
+
+#pragma endregion
+}
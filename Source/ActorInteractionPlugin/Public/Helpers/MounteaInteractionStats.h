@@ -0,0 +1,57 @@
+// Copyright Dominik Morse (Pavlicek) 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Stat group definition, use `stat MounteaInteraction` to display
+DECLARE_STATS_GROUP(TEXT("MounteaInteraction"), STATGROUP_MounteaInteraction, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Trace"), STAT_MounteaInteraction_ProcessTrace, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Trace Query"), STAT_MounteaInteraction_TraceQuery, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Safety Trace"), STAT_MounteaInteraction_SafetyTrace, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle Start Overlap"), STAT_MounteaInteraction_HandleStartOverlap, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle End Overlap"), STAT_MounteaInteraction_HandleEndOverlap, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactable Set State"), STAT_MounteaInteraction_InteractableSetState, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactor Set State"), STAT_MounteaInteraction_InteractorSetState, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Dependencies"), STAT_MounteaInteraction_ProcessDependencies, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Highlight"), STAT_MounteaInteraction_Highlight, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget Update"), STAT_MounteaInteraction_WidgetUpdate, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Provider Promotion"), STAT_MounteaInteraction_ProviderPromotion, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rewind Validation"), STAT_MounteaInteraction_RewindValidation, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Snapshot"), STAT_MounteaInteraction_CaptureSnapshot, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Restore Snapshot"), STAT_MounteaInteraction_RestoreSnapshot, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Initialize Interactables"), STAT_MounteaInteraction_InitializeInteractables, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+
+// Tracing
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces Full"), STAT_MounteaInteraction_TracesFull, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces Skipped (Coherent)"), STAT_MounteaInteraction_TracesSkipped, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits Evaluated"), STAT_MounteaInteraction_HitsEvaluated, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Safety Traces"), STAT_MounteaInteraction_SafetyTraces, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+
+// State, Presentation & Network
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("State Transitions"), STAT_MounteaInteraction_StateTransitions, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widget Updates"), STAT_MounteaInteraction_WidgetUpdates, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RPCs Sent"), STAT_MounteaInteraction_RPCsSent, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Presentation Updates"), STAT_MounteaInteraction_PresentationUpdates, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Interaction Starts"), STAT_MounteaInteraction_BatchedStarts, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rewound Validations"), STAT_MounteaInteraction_RewoundValidations, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interactable Initializations"), STAT_MounteaInteraction_DeferredInitializations, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Interactables"), STAT_MounteaInteraction_QueuedInteractables, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Interaction Handles"), STAT_MounteaInteraction_InteractionHandles, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Rewind Buffers"), STAT_MounteaInteraction_RewindMemory, STATGROUP_MounteaInteraction, ACTORINTERACTIONPLUGIN_API);
+
+/**
+ * Named CPU scope visible in Unreal Insights together with cycle counter visible in `stat MounteaInteraction`.
+ * Compiled out in Shipping.
+ */
+#if !UE_BUILD_SHIPPING
+#define MOUNTEA_INTERACTION_SCOPE(ScopeName, StatName) \
+TRACE_CPUPROFILER_EVENT_SCOPE(ScopeName); \
+SCOPE_CYCLE_COUNTER(StatName)
+#else
+#define MOUNTEA_INTERACTION_SCOPE(ScopeName, StatName)
+#endif
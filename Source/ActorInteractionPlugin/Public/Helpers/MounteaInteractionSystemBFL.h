@@ -68,6 +68,7 @@ public:
 
 	/**
 	 * Determines if cosmetic events can be executed in the specified world context.
+	 * Never on dedicated servers, nor anywhere while `Mountea.Interaction.Cosmetics` is false.
 	 *
 	 * @param WorldContext	The world context to check.
 	 * @return							True if cosmetic events can be executed, false otherwise.
@@ -89,4 +90,26 @@ public:
 	
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Mountea|Interaction|Helpers")
 	static bool IsInputKeyPairSupported(class APlayerController* PlayerController, const FKey& InputKey, const FString& HardwareDeviceID, TSoftObjectPtr<class UTexture2D>& FoundInputTexture);
+
+	/**
+	 * Captures state of every Interactable in World into compact binary Snapshot, to be stored in Save Game.
+	 * Server only.
+	 * 
+	 * @param WorldContextObject	Object to get World from.
+	 * @param Snapshot				Binary Snapshot of Interactables.
+	 * @return							Number of captured Interactables.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Helpers", meta=(WorldContext="WorldContextObject"))
+	static int32 CaptureInteractablesSnapshot(const UObject* WorldContextObject, TArray<uint8>& Snapshot);
+
+	/**
+	 * Restores state of Interactables in World from Snapshot, without triggering State Machine or events.
+	 * Server only.
+	 * 
+	 * @param WorldContextObject	Object to get World from.
+	 * @param Snapshot				Binary Snapshot captured by CaptureInteractablesSnapshot.
+	 * @return							Number of restored Interactables, -1 if Snapshot is invalid.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mountea|Interaction|Helpers", meta=(WorldContext="WorldContextObject"))
+	static int32 RestoreInteractablesSnapshot(const UObject* WorldContextObject, const TArray<uint8>& Snapshot);
 };
@@ -0,0 +1,42 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Gameplay Tags precomputed as bitset over Interaction Tags subtree.
+ *
+ * Every Tag under Interaction Tags Root, including the Root, gets one bit, up to 64 Tags.
+ * Container bits include parents of its Tags, so single AND gives the same result as `HasTag`.
+ * Tags without bit are matched by `HasTag` instead.
+ * Bits are rebuilt when Gameplay Tag tree or Interaction Tags Root change in Editor, cached bits compare their Generation.
+ */
+struct ACTORINTERACTIONPLUGIN_API FMounteaInteractionTagBits
+{
+	static constexpr int32 MaxTags = 64;
+
+	uint64																										Bits = 0;
+	uint32																										Generation = 0;
+
+	/**
+	 * Returns bit of given Tag, 0 if Tag is outside of Interaction Tags subtree or subtree has too many Tags.
+	 */
+	static uint64 GetTagBit(const FGameplayTag& Tag);
+
+	static FMounteaInteractionTagBits FromContainer(const FGameplayTagContainer& Tags);
+
+	/**
+	 * Discards Tag bits, they are rebuilt on next use. Bits cached before are no longer current.
+	 */
+	static void Invalidate();
+
+	static uint32 GetGeneration();
+
+	bool IsCurrent() const
+	{ return Generation == GetGeneration(); };
+
+	bool HasTagBit(const uint64 TagBit) const
+	{ return (Bits & TagBit) != 0; };
+};
@@ -413,6 +413,7 @@ public:
 
 	/**
 	 * Returns Interaction Progress.
+	 * Reconstructed from replicated Server start time, so it is cheap to poll every frame on Server and Clients.
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Mountea|Interaction|Interactable")
 	float GetInteractionProgress() const;
@@ -735,6 +736,7 @@ public:
 	 * Tries to add new Highlightable Component.
 	 * Calls OnHighlightableComponentAdded.
 	 * Duplicates or null not allowed.
+	 * Ignored on dedicated servers, Highlight is cosmetic only.
 	 * @param HighlightableComp Mesh Component to be added to List of Highlightable Components
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Mountea|Interaction|Interactable")
@@ -1059,9 +1061,99 @@ public:
 
 	virtual FTimerHandle& GetCooldownHandle() = 0;
 	virtual FInteractableStateChanged& GetInteractableStateChanged() = 0;
+	virtual FInteractableWeightChanged& GetInteractableWeightChanged() = 0;
 
 	virtual FInteractableWidgetVisibilityChanged& GetInteractableWidgetVisibilityChangedHandle() = 0;
 
 	virtual FInputActionConsumed& GetInputActionConsumedHandle() = 0;
 	virtual FInteractionDeviceChanged& GetInteractionDeviceChangedHandle() = 0;
+
+	/**
+	 * Native entry points for events raised by other objects, such as Interactors or Interactable Dependencies.
+	 * Default implementation only broadcasts matching delegate.
+	 * Interactable Components override those to reach their own handlers directly and keep delegates for Blueprint listeners.
+	 */
+	virtual void NotifyInteractableSelected(const TScriptInterface<IActorInteractableInterface>& SelectedInteractable)
+	{ GetOnInteractableSelectedHandle().Broadcast(SelectedInteractable); };
+	virtual void NotifyInteractorFound(const TScriptInterface<IActorInteractorInterface>& FoundInteractor)
+	{ GetOnInteractorFoundHandle().Broadcast(FoundInteractor); };
+	virtual void NotifyInteractorLost(const TScriptInterface<IActorInteractorInterface>& LostInteractor)
+	{ GetOnInteractorLostHandle().Broadcast(LostInteractor); };
+	virtual void NotifyInteractorOverlapped(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+	{ GetOnInteractorOverlappedHandle().Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult); };
+	virtual void NotifyInteractorStopOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+	{ GetOnInteractorStopOverlapHandle().Broadcast(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex); };
+	virtual void NotifyInteractorTraced(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+	{ GetOnInteractorTracedHandle().Broadcast(HitComponent, OtherActor, OtherComp, NormalImpulse, Hit); };
+	virtual void NotifyInteractionStarted(const float& TimeStarted, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+	{ GetOnInteractionStartedHandle().Broadcast(TimeStarted, CausingInteractor); };
+	virtual void NotifyInteractionStopped(const float& TimeStopped, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+	{ GetOnInteractionStoppedHandle().Broadcast(TimeStopped, CausingInteractor); };
+	virtual void NotifyInteractableDependencyStarted(const TScriptInterface<IActorInteractableInterface>& NewMaster)
+	{ GetInteractableDependencyStarted().Broadcast(NewMaster); };
+	virtual void NotifyInteractableDependencyStopped(const TScriptInterface<IActorInteractableInterface>& FormerMaster)
+	{ GetInteractableDependencyStopped().Broadcast(FormerMaster); };
+
+	/**
+	 * Native hooks for Interactables which address single items of Collision Components, such as Instances of Instanced Static Mesh.
+	 * Default implementation accepts any Hit and ignores targeting.
+	 */
+	virtual bool CanBeTriggeredByHit(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor) const
+	{ return true; };
+	virtual void NotifyHitTargeted(const FHitResult& Hit, const TScriptInterface<IActorInteractorInterface>& TargetingInteractor)
+	{};
+
+	/**
+	 * Returns Owner Transform at given Server time, used by Server to validate Clients against what they have seen.
+	 * Default implementation keeps no history and returns false.
+	 */
+	virtual bool GetRewoundTransform(const float Time, FTransform& OutTransform) const
+	{ return false; };
+
+	/**
+	 * Native queries for hot paths, such as candidate evaluation of Interactors.
+	 * Default implementation calls Blueprint Native Events, Interactable Components answer from cached flags.
+	 */
+	virtual bool CanInteractNative() const
+	{ return Execute_CanInteract(_getUObject()); };
+	virtual bool CanBeTriggeredNative() const
+	{ return Execute_CanBeTriggered(_getUObject()); };
+
+	/**
+	 * Returns whether Interactor with given Tag is compatible with this Interactable.
+	 * TagBit is precomputed bit of the Tag, 0 if it has none. Default implementation matches Compatible Tags by `HasTag`.
+	 */
+	virtual bool IsCompatibleWithTag(const FGameplayTag& Tag, const uint64 TagBit) const
+	{ return Execute_GetInteractableCompatibleTags(_getUObject()).HasTag(Tag); };
+
+	/**
+	 * Returns whether Interactors of given Class are ignored by this Interactable.
+	 * Default implementation walks Ignored Classes, Interactable Components answer from cache of their Archetype.
+	 */
+	virtual bool IsInteractorClassIgnored(const UClass* InteractorClass) const
+	{
+		if (!InteractorClass) return false;
+
+		for (const TSoftClassPtr<UObject>& ignoredClass : Execute_GetIgnoredClasses(_getUObject()))
+		{
+			if (ignoredClass.Get() && InteractorClass->IsChildOf(ignoredClass.Get()))
+				return true;
+		}
+		return false;
+	};
+
+	/**
+	 * Native hooks for Interactables which expect repeated Interaction starts, such as Mash.
+	 * Clients gather such starts and send them as single batch, Stops are not sent while batching.
+	 * Default implementation does not batch and replays batch as separate starts.
+	 */
+	virtual bool CanBatchInteractionStarts() const
+	{ return false; };
+	virtual void NotifyInteractionStartsBatched(const int32 Count, const float FirstTime, const float LastTime, const TScriptInterface<IActorInteractorInterface>& CausingInteractor)
+	{
+		for (int32 startIndex = 0; startIndex < Count; startIndex++)
+		{
+			NotifyInteractionStarted(Count > 1 ? FMath::Lerp(FirstTime, LastTime, static_cast<float>(startIndex) / (Count - 1)) : LastTime, CausingInteractor);
+		}
+	};
 };
\ No newline at end of file
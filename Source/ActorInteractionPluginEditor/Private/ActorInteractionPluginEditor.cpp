@@ -11,6 +11,7 @@
 
 #include "AssetActions/InteractorComponentAssetActions.h"
 #include "AssetActions/InteractableComponentAssetActions.h"
+#include "Components/Interactable/ActorInteractableComponentWidgetless.h"
 
 #include "AssetToolsModule.h"
 #include "HttpModule.h"
@@ -129,6 +130,14 @@ void FActorInteractionPluginEditor::StartupModule()
 			FKismetEditorUtilities::FOnBlueprintCreated::CreateRaw(this, &FActorInteractionPluginEditor::HandleNewInteractableBlueprintCreated)
 		);
 
+		// New Widgetless Interactable
+		FKismetEditorUtilities::RegisterOnBlueprintCreatedCallback
+		(
+			this,
+			UActorInteractableComponentWidgetless::StaticClass(),
+			FKismetEditorUtilities::FOnBlueprintCreated::CreateRaw(this, &FActorInteractionPluginEditor::HandleNewInteractableBlueprintCreated)
+		);
+
 		// New Interactor
 		FKismetEditorUtilities::RegisterOnBlueprintCreatedCallback
 		(
@@ -221,11 +230,14 @@ void FActorInteractionPluginEditor::HandleNewInteractableBlueprintCreated(UBluep
 	}
 
 	Blueprint->bForceFullEditor = true;
+	UClass* InteractableClass = Blueprint->ParentClass && Blueprint->ParentClass->IsChildOf(UActorInteractableComponentWidgetless::StaticClass())
+		? UActorInteractableComponentWidgetless::StaticClass()
+		: UActorInteractableComponentBase::StaticClass();
 	UEdGraph* FunctionGraph = FActorInteractionEditorUtilities::BlueprintGetOrAddFunction
 	(
 		Blueprint,
 		GET_FUNCTION_NAME_CHECKED(UActorInteractableComponentBase, CanInteract),
-		UActorInteractableComponentBase::StaticClass()
+		InteractableClass
 	);
 	
 	if (FunctionGraph)
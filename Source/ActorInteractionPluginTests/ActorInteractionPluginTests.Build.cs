@@ -0,0 +1,34 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+using System.IO;
+using UnrealBuildTool;
+
+public class ActorInteractionPluginTests : ModuleRules
+{
+	public ActorInteractionPluginTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PrecompileForTargets = PrecompileTargetsType.None;
+		bPrecompile = false;
+		bUsePrecompiled = false;
+
+		PublicDependencyModuleNames.AddRange
+			(
+				new string[]
+				{
+					"Core",
+					"CoreUObject",
+					"Engine"
+				}
+			);
+		
+		PrivateDependencyModuleNames.AddRange
+			(
+				new string[]
+				{
+					"ActorInteractionPlugin"
+				}
+			);
+	}
+}
@@ -0,0 +1,22 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "ActorInteractionPluginTests.h"
+
+#include "Benchmarks/MounteaInteractionBenchmark.h"
+
+DEFINE_LOG_CATEGORY(LogActorInteractionTests);
+
+#define LOCTEXT_NAMESPACE "FActorInteractionPluginTests"
+
+void FActorInteractionPluginTests::StartupModule()
+{
+	FMounteaInteractionBenchmark::InstallAllocationCounting();
+}
+
+void FActorInteractionPluginTests::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FActorInteractionPluginTests, ActorInteractionPluginTests)
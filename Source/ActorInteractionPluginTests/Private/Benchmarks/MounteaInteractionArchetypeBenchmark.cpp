@@ -0,0 +1,73 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Helpers/MounteaInteractableArchetype.h"
+
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures memory of pickups configured individually compared to pickups sharing one Archetype.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.ArchetypeMemory; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionArchetypeBenchmarkTest, "Mountea.Interaction.Benchmark.ArchetypeMemory", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionArchetypeBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FMounteaBenchmarkConfig config;
+	config.InteractablesCount = 20000;
+	config.ParseCommandLine();
+	config.InteractableClass = UActorInteractableComponentPress::StaticClass();
+	config.bPickups = true;
+
+	// Every pickup owns its configuration
+	FMounteaBenchmarkResult perInstanceResult;
+	{
+		config.ScenarioName = TEXT("Archetype.PerInstance");
+
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunSpawn(perInstanceResult))
+		{
+			AddError(TEXT("Failed to spawn per instance pickups"));
+			return false;
+		}
+
+		FMounteaInteractionBenchmark::WriteCSV(config, perInstanceResult);
+	}
+
+	// Every pickup points to one Archetype
+	FMounteaBenchmarkResult sharedResult;
+	{
+		const TStrongObjectPtr<UMounteaInteractableArchetype> pickupArchetype(NewObject<UMounteaInteractableArchetype>(GetTransientPackage()));
+		pickupArchetype->Settings.InteractionPeriod = -1.f;
+		pickupArchetype->Settings.LifecycleMode = EInteractableLifecycle::EIL_OnlyOnce;
+
+		config.ScenarioName = TEXT("Archetype.Shared");
+		config.InteractableArchetype = pickupArchetype.Get();
+
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunSpawn(sharedResult))
+		{
+			AddError(TEXT("Failed to spawn shared Archetype pickups"));
+			return false;
+		}
+
+		FMounteaInteractionBenchmark::WriteCSV(config, sharedResult);
+	}
+
+	const double savedBytes = perInstanceResult.BytesPerInteractable - sharedResult.BytesPerInteractable;
+
+	AddInfo(FString::Printf(TEXT("Per instance: %.1f B per pickup (%.1f B configuration)"), perInstanceResult.BytesPerInteractable, perInstanceResult.ArchetypeBytesPerInteractable));
+	AddInfo(FString::Printf(TEXT("Shared Archetype: %.1f B per pickup (%.1f B configuration)"), sharedResult.BytesPerInteractable, sharedResult.ArchetypeBytesPerInteractable));
+	AddInfo(FString::Printf(TEXT("Saved: %.1f B per pickup, %.2f MB for %d pickups"), savedBytes, savedBytes * config.InteractablesCount / (1024.0 * 1024.0), config.InteractablesCount));
+
+	return true;
+}
+
+#endif
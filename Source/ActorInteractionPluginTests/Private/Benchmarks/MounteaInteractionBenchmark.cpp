@@ -0,0 +1,745 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "ActorInteractionPluginTests.h"
+#include "MounteaInteractionBenchmarkComponents.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/Interactable/ActorInteractableComponentBase.h"
+#include "Helpers/ActorInteractionPluginSettings.h"
+#include "Helpers/MounteaInteractableArchetype.h"
+#include "Helpers/MounteaInteractableInitializationSubsystem.h"
+#include "Helpers/MounteaInteractionSnapshot.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveCountMem.h"
+
+#include <atomic>
+
+#pragma region AllocationCounting
+
+/**
+ * Malloc proxy counting allocations made on Game Thread.
+ * Every call is forwarded to the original allocator, blocks allocated before installation are freed by it too.
+ */
+class FMallocCountingProxy final : public FMalloc
+{
+public:
+
+	explicit FMallocCountingProxy(FMalloc* InMalloc) : InnerMalloc(InMalloc)
+	{};
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override
+	{ InnerMalloc->Free(Original); }
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{ return InnerMalloc->QuantizeSize(Count, Alignment); }
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{ return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+
+	virtual void Trim(bool bTrimThreadCaches) override
+	{ InnerMalloc->Trim(bTrimThreadCaches); }
+
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{ InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{ InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+	{ InnerMalloc->GetAllocatorStats(OutStats); }
+
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+	{ InnerMalloc->DumpAllocatorStats(Ar); }
+
+	virtual bool ValidateHeap() override
+	{ return InnerMalloc->ValidateHeap(); }
+
+	virtual bool IsInternallyThreadSafe() const override
+	{ return InnerMalloc->IsInternallyThreadSafe(); }
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{ return InnerMalloc->GetDescriptiveName(); }
+
+	uint64 GetAllocations() const
+	{ return Allocations.load(std::memory_order_relaxed); };
+
+private:
+
+	// Other threads allocate while Game Thread runs Traces, they would only add noise
+	void CountAllocation()
+	{
+		if (IsInGameThread())
+		{
+			Allocations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	FMalloc* InnerMalloc = nullptr;
+	std::atomic<uint64> Allocations { 0 };
+};
+
+static FMallocCountingProxy* GBenchmarkMallocProxy = nullptr;
+
+void FMounteaInteractionBenchmark::InstallAllocationCounting()
+{
+	check(IsInGameThread());
+
+	if (GBenchmarkMallocProxy || !FParse::Param(FCommandLine::Get(), TEXT("MounteaBenchAllocations")))
+		return;
+
+	// Proxy is allocated by the original allocator before it is installed and stays alive until exit
+	GBenchmarkMallocProxy = new FMallocCountingProxy(GMalloc);
+	GMalloc = GBenchmarkMallocProxy;
+}
+
+bool FMounteaInteractionBenchmark::IsCountingAllocations()
+{
+	return GBenchmarkMallocProxy != nullptr;
+}
+
+uint64 FMounteaInteractionBenchmark::GetAllocationsCount()
+{
+	return GBenchmarkMallocProxy ? GBenchmarkMallocProxy->GetAllocations() : 0;
+}
+
+#pragma endregion
+
+#pragma region Config
+
+void FMounteaBenchmarkConfig::ParseCommandLine()
+{
+	const TCHAR* commandLine = FCommandLine::Get();
+	
+	FParse::Value(commandLine, TEXT("MounteaBenchInteractables="), InteractablesCount);
+	FParse::Value(commandLine, TEXT("MounteaBenchInteractors="), InteractorsCount);
+	FParse::Value(commandLine, TEXT("MounteaBenchFrames="), FramesCount);
+	FParse::Value(commandLine, TEXT("MounteaBenchSpacing="), GridSpacing);
+	FParse::Value(commandLine, TEXT("MounteaBenchInitBudget="), InitializationBudgetMs);
+	FParse::Value(commandLine, TEXT("MounteaBenchCSV="), OutputPath);
+
+	InteractablesCount = FMath::Max(1, InteractablesCount);
+	InteractorsCount = FMath::Max(1, InteractorsCount);
+	FramesCount = FMath::Max(1, FramesCount);
+	GridSpacing = FMath::Max(10.f, GridSpacing);
+	InitializationBudgetMs = FMath::Clamp(InitializationBudgetMs, 0.01f, 16.f);
+
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("MounteaInteraction.csv"));
+	}
+}
+
+FString FMounteaBenchmarkResult::GetCSVHeader()
+{
+	return TEXT("Scenario,Interactables,Interactors,Frames,ProcessTraceAvgMs,ProcessTraceMaxMs,HandleStartOverlapAvgMs,HandleStartOverlapMaxMs,SetStateAvgMs,SetStateMaxMs,WidgetToggleAvgMs,WidgetToggleMaxMs,EventDispatchAvgMs,EventDispatchMaxMs,SpawnMsPerInteractable,AllocationsPerTrace,BytesPerInteractable,ArchetypeBytesPerInteractable,ProcessMemoryPerInteractable");
+}
+
+FString FMounteaBenchmarkResult::ToCSVRow(const FMounteaBenchmarkConfig& Config) const
+{
+	return FString::Printf
+	(
+		TEXT("%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%.1f,%.1f,%.1f"),
+		*Config.ScenarioName, Config.InteractablesCount, Config.InteractorsCount, Config.FramesCount,
+		ProcessTrace.GetAverageMs(), ProcessTrace.MaxMs,
+		HandleStartOverlap.GetAverageMs(), HandleStartOverlap.MaxMs,
+		SetState.GetAverageMs(), SetState.MaxMs,
+		WidgetToggle.GetAverageMs(), WidgetToggle.MaxMs,
+		EventDispatch.GetAverageMs(), EventDispatch.MaxMs,
+		SpawnMsPerInteractable,
+		AllocationsPerTrace, BytesPerInteractable, ArchetypeBytesPerInteractable, ProcessMemoryPerInteractable
+	);
+}
+
+#pragma endregion
+
+FMounteaInteractionBenchmark::FMounteaInteractionBenchmark(const FMounteaBenchmarkConfig& InConfig) : Config(InConfig)
+{
+}
+
+FMounteaInteractionBenchmark::~FMounteaInteractionBenchmark()
+{
+	DestroyWorld();
+}
+
+bool FMounteaInteractionBenchmark::Run(FMounteaBenchmarkResult& OutResult)
+{
+	if (!BeginScenario())
+		return false;
+
+	SpawnInteractables(OutResult);
+	SpawnInteractors();
+
+	for (int32 Frame = 0; Frame < Config.FramesCount; Frame++)
+	{
+		MoveInteractors(Frame);
+		RunFrame(OutResult);
+		
+		World->Tick(LEVELTICK_All, Config.FrameDeltaTime);
+	}
+
+	if (IsCountingAllocations())
+	{
+		OutResult.AllocationsPerTrace = TracesCount > 0 ? static_cast<double>(TraceAllocations) / static_cast<double>(TracesCount) : 0.0;
+	}
+
+	DestroyWorld();
+	return true;
+}
+
+bool FMounteaInteractionBenchmark::RunStateTransitions(FMounteaBenchmarkTiming& OutTiming, int32& OutTransitionsPerFrame)
+{
+	if (!BeginScenario())
+		return false;
+
+	FMounteaBenchmarkResult spawnResult;
+	SpawnInteractables(spawnResult);
+
+	// Covers plain, highlight, timer and collision rebinding transitions and returns back to Awake
+	static const EInteractableStateV2 stateCycle[] =
+	{
+		EInteractableStateV2::EIS_Active,
+		EInteractableStateV2::EIS_Paused,
+		EInteractableStateV2::EIS_Active,
+		EInteractableStateV2::EIS_Cooldown,
+		EInteractableStateV2::EIS_Suppressed,
+		EInteractableStateV2::EIS_Awake,
+		EInteractableStateV2::EIS_Asleep,
+		EInteractableStateV2::EIS_Awake
+	};
+
+	OutTransitionsPerFrame = UE_ARRAY_COUNT(stateCycle) * Interactables.Num();
+	
+	bool bAllReached = true;
+	for (int32 Frame = 0; Frame < Config.FramesCount; Frame++)
+	{
+		double stateSeconds = 0.0;
+		
+		for (const auto& Itr : Interactables)
+		{
+			UActorInteractableComponentBase* interactable = Itr.Get();
+			if (!interactable)
+				continue;
+
+			IActorInteractableInterface::Execute_SetState(interactable, EInteractableStateV2::EIS_Awake);
+			
+			for (const EInteractableStateV2 targetState : stateCycle)
+			{
+				const double startTime = FPlatformTime::Seconds();
+				
+				IActorInteractableInterface::Execute_SetState(interactable, targetState);
+				
+				stateSeconds += FPlatformTime::Seconds() - startTime;
+
+				bAllReached &= IActorInteractableInterface::Execute_GetState(interactable) == targetState;
+			}
+		}
+
+		OutTiming.AddFrame(stateSeconds * 1000.0);
+		
+		World->Tick(LEVELTICK_All, Config.FrameDeltaTime);
+	}
+
+	DestroyWorld();
+	return bAllReached;
+}
+
+bool FMounteaInteractionBenchmark::RunSpawn(FMounteaBenchmarkResult& OutResult)
+{
+	if (!BeginScenario())
+		return false;
+
+	SpawnInteractables(OutResult);
+
+	DestroyWorld();
+	return true;
+}
+
+bool FMounteaInteractionBenchmark::RunSnapshot(double& OutCaptureMs, double& OutRestoreMs, int32& OutSnapshotBytes)
+{
+	if (!BeginScenario())
+		return false;
+
+	FMounteaBenchmarkResult spawnResult;
+	SpawnInteractables(spawnResult);
+
+	// Mix of States, Weights and Lifecycles, so records are not identical
+	for (int32 i = 0; i < Interactables.Num(); i++)
+	{
+		UActorInteractableComponentBase* interactable = Interactables[i].Get();
+		if (!interactable)
+			continue;
+
+		IActorInteractableInterface::Execute_SetInteractableWeight(interactable, i % 7);
+		interactable->SetRemainingLifecycleCount(i % 4 == 0 ? i % 10 : -1);
+		if (i % 3 == 0)
+		{
+			IActorInteractableInterface::Execute_SetState(interactable, EInteractableStateV2::EIS_Asleep);
+		}
+	}
+
+	TArray<FMounteaInteractableSnapshotRecord> expectedRecords;
+	TSet<uint64> snapshotIds;
+	for (const TWeakObjectPtr<UActorInteractableComponentBase>& interactable : Interactables)
+	{
+		if (!interactable.IsValid())
+			continue;
+
+		interactable->CaptureSnapshotRecord(expectedRecords.AddDefaulted_GetRef());
+
+		bool bIsDuplicateId = false;
+		snapshotIds.Add(expectedRecords.Last().Id, &bIsDuplicateId);
+		if (bIsDuplicateId)
+		{
+			UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] %s shares Snapshot ID with another Interactable!"), *Config.ScenarioName, *interactable->GetPathName());
+		}
+	}
+
+	TArray<uint8> snapshot;
+	
+	double startTime = FPlatformTime::Seconds();
+	const int32 capturedCount = FMounteaInteractionSnapshot::Capture(World, snapshot);
+	OutCaptureMs = (FPlatformTime::Seconds() - startTime) * 1000.0;
+
+	// Overwrite captured values, so restore has to bring every one of them back
+	for (const TWeakObjectPtr<UActorInteractableComponentBase>& interactable : Interactables)
+	{
+		if (!interactable.IsValid())
+			continue;
+
+		IActorInteractableInterface::Execute_SetInteractableWeight(interactable.Get(), 100);
+		interactable->SetRemainingLifecycleCount(100);
+		if (IActorInteractableInterface::Execute_GetState(interactable.Get()) == EInteractableStateV2::EIS_Asleep)
+		{
+			IActorInteractableInterface::Execute_SetState(interactable.Get(), EInteractableStateV2::EIS_Awake);
+		}
+	}
+
+	startTime = FPlatformTime::Seconds();
+	const int32 restoredCount = FMounteaInteractionSnapshot::Restore(World, snapshot);
+	OutRestoreMs = (FPlatformTime::Seconds() - startTime) * 1000.0;
+
+	OutSnapshotBytes = snapshot.Num();
+
+	int32 matchingCount = 0;
+	for (int32 i = 0, recordIndex = 0; i < Interactables.Num(); i++)
+	{
+		const UActorInteractableComponentBase* interactable = Interactables[i].Get();
+		if (!interactable)
+			continue;
+
+		FMounteaInteractableSnapshotRecord restoredRecord;
+		interactable->CaptureSnapshotRecord(restoredRecord);
+
+		const FMounteaInteractableSnapshotRecord& expectedRecord = expectedRecords[recordIndex++];
+		if (restoredRecord.Id != expectedRecord.Id || restoredRecord.State != expectedRecord.State || restoredRecord.RemainingLifecycleCount != expectedRecord.RemainingLifecycleCount
+			|| restoredRecord.InteractionWeight != expectedRecord.InteractionWeight || !FMath::IsNearlyEqual(restoredRecord.RemainingCooldown, expectedRecord.RemainingCooldown, 0.05f))
+		{
+			UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] %s differs after Snapshot round trip!"), *Config.ScenarioName, *interactable->GetPathName());
+			continue;
+		}
+
+		matchingCount++;
+	}
+
+	const int32 interactablesCount = Interactables.Num();
+	
+	DestroyWorld();
+	return capturedCount == interactablesCount && restoredCount == interactablesCount && matchingCount == interactablesCount && snapshotIds.Num() == interactablesCount;
+}
+
+bool FMounteaInteractionBenchmark::RunDeferredInitialization(FMounteaBenchmarkTiming& OutTiming, double& OutSpawnMs, int32& OutFramesToDrain)
+{
+	// Budget is opt-in, enable it only for this scenario
+	const FFloatProperty* budgetProperty = FindFProperty<FFloatProperty>(UActorInteractionPluginSettings::StaticClass(), TEXT("InteractableInitializationBudget"));
+	if (!budgetProperty)
+	{
+		UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] Interactable Initialization Budget setting not found!"), *Config.ScenarioName);
+		return false;
+	}
+
+	float& initializationBudget = *budgetProperty->ContainerPtrToValuePtr<float>(GetMutableDefault<UActorInteractionPluginSettings>());
+	TGuardValue<float> budgetGuard(initializationBudget, Config.InitializationBudgetMs);
+
+	if (!BeginScenario())
+		return false;
+
+	const UMounteaInteractableInitializationSubsystem* initializationSubsystem = World->GetSubsystem<UMounteaInteractableInitializationSubsystem>();
+	if (!initializationSubsystem)
+	{
+		UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] Benchmark World has no initialization queue!"), *Config.ScenarioName);
+		DestroyWorld();
+		return false;
+	}
+
+	FMounteaBenchmarkResult spawnResult;
+	SpawnInteractables(spawnResult);
+	SpawnInteractors();
+
+	OutSpawnMs = spawnResult.SpawnMsPerInteractable * Interactables.Num();
+
+	// Every frame initializes at least one Interactable
+	const int32 maxFrames = Interactables.Num() + 1;
+	
+	OutFramesToDrain = 0;
+	while (initializationSubsystem->GetQueuedCount() > 0 && OutFramesToDrain < maxFrames)
+	{
+		const double startTime = FPlatformTime::Seconds();
+		
+		World->Tick(LEVELTICK_All, Config.FrameDeltaTime);
+		
+		OutTiming.AddFrame((FPlatformTime::Seconds() - startTime) * 1000.0);
+		OutFramesToDrain++;
+	}
+
+	bool bAllInitialized = initializationSubsystem->GetQueuedCount() == 0;
+	for (const auto& Itr : Interactables)
+	{
+		bAllInitialized &= Itr.IsValid() && Itr->IsInteractableInitialized();
+	}
+
+	DestroyWorld();
+	return bAllInitialized;
+}
+
+bool FMounteaInteractionBenchmark::BeginScenario()
+{
+	if (!Config.InteractableClass)
+	{
+		UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] No Interactable Class!"), *Config.ScenarioName);
+		return false;
+	}
+	
+	if (!CreateWorld())
+	{
+		UE_LOG(LogActorInteractionTests, Error, TEXT("[%s] Failed to create benchmark World!"), *Config.ScenarioName);
+		return false;
+	}
+
+	return true;
+}
+
+bool FMounteaInteractionBenchmark::CreateWorld()
+{
+	if (!GEngine)
+		return false;
+	
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MounteaInteractionBenchmark"));
+	if (!World)
+		return false;
+
+	FWorldContext& worldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	worldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	return true;
+}
+
+void FMounteaInteractionBenchmark::DestroyWorld()
+{
+	if (!World)
+		return;
+
+	Interactables.Empty();
+	Interactors.Empty();
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World = nullptr;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FMounteaInteractionBenchmark::SpawnInteractables(FMounteaBenchmarkResult& OutResult)
+{
+	const int32 gridSide = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Config.InteractablesCount)));
+	GridCenter = FVector(gridSide * Config.GridSpacing * 0.5f, gridSide * Config.GridSpacing * 0.5f, 0.f);
+	PathRadius = gridSide * Config.GridSpacing * 0.5f;
+
+	const uint64 memoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+	uint64 countedBytes = 0;
+	uint64 archetypeBytes = 0;
+	double spawnSeconds = 0.0;
+
+	if (Config.InteractableArchetype)
+	{
+		// Shared Archetype is paid once for the whole grid
+		FArchiveCountMem sharedArchetypeMemory(Config.InteractableArchetype);
+		archetypeBytes += sharedArchetypeMemory.GetMax();
+	}
+
+	for (int32 i = 0; i < Config.InteractablesCount; i++)
+	{
+		const FVector location((i % gridSide) * Config.GridSpacing, (i / gridSide) * Config.GridSpacing, 0.f);
+		
+		AActor* interactableActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(location));
+		if (!interactableActor)
+			continue;
+
+		UBoxComponent* collisionBox = NewObject<UBoxComponent>(interactableActor, TEXT("InteractableCollision"));
+		collisionBox->SetBoxExtent(FVector(25.f));
+		collisionBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		collisionBox->SetCollisionResponseToAllChannels(ECR_Ignore);
+		interactableActor->SetRootComponent(collisionBox);
+		collisionBox->RegisterComponent();
+
+		// Spawn cost covers component creation, registration and BeginPlay
+		const double spawnStartTime = FPlatformTime::Seconds();
+		
+		UActorInteractableComponentBase* interactable = NewObject<UActorInteractableComponentBase>(interactableActor, Config.InteractableClass);
+		interactable->SetupAttachment(collisionBox);
+		IActorInteractableInterface::Execute_SetCollisionChannel(interactable, ECC_Camera);
+		IActorInteractableInterface::Execute_AddCollisionComponent(interactable, collisionBox);
+		if (Config.InteractableArchetype)
+		{
+			interactable->SetInteractableArchetype(Config.InteractableArchetype);
+		}
+		interactable->RegisterComponent();
+		if (!Config.bDeferInitialization)
+		{
+			UMounteaInteractableInitializationSubsystem::InitializeImmediately(interactable);
+		}
+		if (Config.bPickups && !Config.InteractableArchetype)
+		{
+			IActorInteractableInterface::Execute_SetLifecycleMode(interactable, EInteractableLifecycle::EIL_OnlyOnce);
+		}
+
+		spawnSeconds += FPlatformTime::Seconds() - spawnStartTime;
+
+		Interactables.Add(interactable);
+
+		FArchiveCountMem actorMemory(interactableActor);
+		FArchiveCountMem collisionMemory(collisionBox);
+		FArchiveCountMem interactableMemory(interactable);
+		countedBytes += actorMemory.GetMax() + collisionMemory.GetMax() + interactableMemory.GetMax();
+
+		// Archive does not follow references, private Archetype copy is counted separately
+		if (UMounteaInteractableArchetype* archetypeOverride = interactable->GetArchetypeOverride())
+		{
+			FArchiveCountMem overrideMemory(archetypeOverride);
+			archetypeBytes += overrideMemory.GetMax();
+		}
+	}
+
+	const uint64 memoryAfter = FPlatformMemory::GetStats().UsedPhysical;
+	const int32 spawnedCount = FMath::Max(1, Interactables.Num());
+
+	OutResult.SpawnMsPerInteractable = spawnSeconds * 1000.0 / spawnedCount;
+	OutResult.BytesPerInteractable = static_cast<double>(countedBytes + archetypeBytes) / spawnedCount;
+	OutResult.ArchetypeBytesPerInteractable = static_cast<double>(archetypeBytes) / spawnedCount;
+	OutResult.ProcessMemoryPerInteractable = memoryAfter > memoryBefore ? static_cast<double>(memoryAfter - memoryBefore) / spawnedCount : 0.0;
+}
+
+void FMounteaInteractionBenchmark::SpawnInteractors()
+{
+	for (int32 i = 0; i < Config.InteractorsCount; i++)
+	{
+		AActor* interactorActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(GridCenter));
+		if (!interactorActor)
+			continue;
+
+		USphereComponent* collisionSphere = NewObject<USphereComponent>(interactorActor, TEXT("InteractorCollision"));
+		collisionSphere->SetSphereRadius(100.f);
+		collisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		collisionSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+		interactorActor->SetRootComponent(collisionSphere);
+		collisionSphere->RegisterComponent();
+
+		UActorInteractorComponentBase* interactor = nullptr;
+		if (Config.InteractorType == EMounteaBenchmarkInteractor::Overlap)
+		{
+			UMounteaBenchmarkInteractorOverlap* overlapInteractor = NewObject<UMounteaBenchmarkInteractorOverlap>(interactorActor);
+			overlapInteractor->AddCollisionComponent(collisionSphere);
+			interactor = overlapInteractor;
+		}
+		else
+		{
+			interactor = NewObject<UMounteaBenchmarkInteractorTrace>(interactorActor);
+		}
+
+		IActorInteractorInterface::Execute_SetResponseChannel(interactor, ECC_Camera);
+		interactor->RegisterComponent();
+
+		Interactors.Add(interactor);
+	}
+}
+
+void FMounteaInteractionBenchmark::MoveInteractors(const int32 Frame)
+{
+	for (int32 i = 0; i < Interactors.Num(); i++)
+	{
+		UActorInteractorComponentBase* interactor = Interactors[i].Get();
+		if (!interactor || !interactor->GetOwner())
+			continue;
+
+		// Each Interactor follows the same circle with different phase, looking to the grid center
+		const float angle = (static_cast<float>(Frame) / Config.FramesCount + static_cast<float>(i) / Interactors.Num()) * UE_TWO_PI;
+		const FVector location = GridCenter + FVector(FMath::Cos(angle), FMath::Sin(angle), 0.f) * PathRadius;
+		const FRotator rotation = (GridCenter - location).Rotation();
+
+		interactor->GetOwner()->SetActorLocationAndRotation(location, rotation);
+	}
+}
+
+void FMounteaInteractionBenchmark::RunFrame(FMounteaBenchmarkResult& OutResult)
+{
+	// Interactors
+	{
+		double traceSeconds = 0.0;
+		double overlapSeconds = 0.0;
+		
+		for (const auto& Itr : Interactors)
+		{
+			if (UMounteaBenchmarkInteractorTrace* traceInteractor = Cast<UMounteaBenchmarkInteractorTrace>(Itr.Get()))
+			{
+				const uint64 allocationsBefore = GetAllocationsCount();
+				const double startTime = FPlatformTime::Seconds();
+				
+				traceInteractor->RunTrace(GetTraceType());
+				
+				traceSeconds += FPlatformTime::Seconds() - startTime;
+				TraceAllocations += GetAllocationsCount() - allocationsBefore;
+				TracesCount++;
+			}
+			else if (UMounteaBenchmarkInteractorOverlap* overlapInteractor = Cast<UMounteaBenchmarkInteractorOverlap>(Itr.Get()))
+			{
+				for (UPrimitiveComponent* collisionShape : overlapInteractor->GetCollisionComponents())
+				{
+					if (!collisionShape)
+						continue;
+					
+					TArray<UPrimitiveComponent*> overlappingComponents;
+					collisionShape->GetOverlappingComponents(overlappingComponents);
+
+					const double startTime = FPlatformTime::Seconds();
+					
+					for (UPrimitiveComponent* overlappingComponent : overlappingComponents)
+					{
+						overlapInteractor->RunStartOverlap(collisionShape, overlappingComponent->GetOwner(), overlappingComponent);
+					}
+
+					overlapSeconds += FPlatformTime::Seconds() - startTime;
+				}
+			}
+		}
+
+		OutResult.ProcessTrace.AddFrame(traceSeconds * 1000.0);
+		OutResult.HandleStartOverlap.AddFrame(overlapSeconds * 1000.0);
+	}
+
+	// Interactables
+	{
+		UActorInteractorComponentBase* toggleInteractor = Interactors.Num() > 0 ? Interactors[0].Get() : nullptr;
+		
+		double stateSeconds = 0.0;
+		double widgetSeconds = 0.0;
+		double eventSeconds = 0.0;
+		
+		for (const auto& Itr : Interactables)
+		{
+			UActorInteractableComponentBase* interactable = Itr.Get();
+			if (!interactable)
+				continue;
+
+			{
+				const double startTime = FPlatformTime::Seconds();
+				
+				IActorInteractableInterface::Execute_SetState(interactable, EInteractableStateV2::EIS_Active);
+				IActorInteractableInterface::Execute_SetState(interactable, EInteractableStateV2::EIS_Awake);
+
+				stateSeconds += FPlatformTime::Seconds() - startTime;
+			}
+
+			// Interactor Found/Lost toggles Widget and Highlight
+			if (toggleInteractor && IActorInteractableInterface::Execute_CanBeTriggered(interactable))
+			{
+				const double startTime = FPlatformTime::Seconds();
+
+				interactable->NotifyInteractorFound(toggleInteractor);
+				interactable->NotifyInteractorLost(toggleInteractor);
+
+				widgetSeconds += FPlatformTime::Seconds() - startTime;
+			}
+
+			// Attribute change dispatching its event without any other side effects
+			{
+				const int32 interactableWeight = IActorInteractableInterface::Execute_GetInteractableWeight(interactable);
+				
+				const double startTime = FPlatformTime::Seconds();
+
+				IActorInteractableInterface::Execute_SetInteractableWeight(interactable, interactableWeight + 1);
+				IActorInteractableInterface::Execute_SetInteractableWeight(interactable, interactableWeight);
+
+				eventSeconds += FPlatformTime::Seconds() - startTime;
+			}
+		}
+
+		OutResult.SetState.AddFrame(stateSeconds * 1000.0);
+		OutResult.WidgetToggle.AddFrame(widgetSeconds * 1000.0);
+		OutResult.EventDispatch.AddFrame(eventSeconds * 1000.0);
+	}
+}
+
+ETraceType FMounteaInteractionBenchmark::GetTraceType() const
+{
+	switch (Config.InteractorType)
+	{
+		case EMounteaBenchmarkInteractor::TracePrecise:
+			return ETraceType::ETT_Precise;
+		case EMounteaBenchmarkInteractor::TraceCone:
+			return ETraceType::ETT_Cone;
+		case EMounteaBenchmarkInteractor::TraceLoose:
+		case EMounteaBenchmarkInteractor::Overlap:
+		default:
+			return ETraceType::ETT_Loose;
+	}
+}
+
+bool FMounteaInteractionBenchmark::WriteCSV(const FMounteaBenchmarkConfig& Config, const FMounteaBenchmarkResult& Result)
+{
+	FString csvContent;
+	if (!IFileManager::Get().FileExists(*Config.OutputPath))
+	{
+		csvContent.Append(FMounteaBenchmarkResult::GetCSVHeader()).Append(LINE_TERMINATOR);
+	}
+	csvContent.Append(Result.ToCSVRow(Config)).Append(LINE_TERMINATOR);
+
+	return FFileHelper::SaveStringToFile(csvContent, *Config.OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
@@ -0,0 +1,189 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Interactor/ActorInteractorComponentTrace.h"
+
+class UWorld;
+class AActor;
+class UActorInteractableComponentBase;
+class UActorInteractorComponentBase;
+class UMounteaInteractableArchetype;
+
+/**
+ * Interactor flavours which can be benchmarked.
+ */
+enum class EMounteaBenchmarkInteractor : uint8
+{
+	TracePrecise,
+	TraceLoose,
+	TraceCone,
+	Overlap
+};
+
+/**
+ * Benchmark scenario configuration.
+ * Defaults can be overridden from command line:
+ * -MounteaBenchInteractables=N -MounteaBenchInteractors=M -MounteaBenchFrames=F -MounteaBenchSpacing=cm -MounteaBenchInitBudget=ms -MounteaBenchCSV=Path
+ */
+struct FMounteaBenchmarkConfig
+{
+	TSubclassOf<UActorInteractableComponentBase> InteractableClass;
+	EMounteaBenchmarkInteractor InteractorType = EMounteaBenchmarkInteractor::TracePrecise;
+	
+	int32 InteractablesCount = 256;
+	int32 InteractorsCount = 8;
+	int32 FramesCount = 120;
+	float GridSpacing = 150.f;
+	float FrameDeltaTime = 1.f / 60.f;
+	FString OutputPath;
+
+	/**
+	 * Configures every Interactable as one-shot pickup.
+	 * With Archetype set it is assigned to every Interactable, otherwise each Interactable is configured individually.
+	 */
+	bool bPickups = false;
+
+	/**
+	 * Leaves Interactable setup to budgeted initialization queue, as streamed World Partition cells do.
+	 * Otherwise every Interactable is initialized while spawning, so spawn cost covers its full setup.
+	 */
+	bool bDeferInitialization = false;
+
+	/**
+	 * Interactable Initialization Budget used while deferred scenario runs, project setting is 0 by default.
+	 */
+	float InitializationBudgetMs = 2.f;
+	UMounteaInteractableArchetype* InteractableArchetype = nullptr;
+
+	FString ScenarioName;
+
+	void ParseCommandLine();
+};
+
+/**
+ * Accumulated per frame timings in milliseconds.
+ */
+struct FMounteaBenchmarkTiming
+{
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+	int32 Samples = 0;
+
+	void AddFrame(const double FrameMs)
+	{
+		TotalMs += FrameMs;
+		MaxMs = FMath::Max(MaxMs, FrameMs);
+		Samples++;
+	};
+
+	double GetAverageMs() const
+	{ return Samples > 0 ? TotalMs / Samples : 0.0; };
+};
+
+struct FMounteaBenchmarkResult
+{
+	FMounteaBenchmarkTiming ProcessTrace;
+	FMounteaBenchmarkTiming HandleStartOverlap;
+	FMounteaBenchmarkTiming SetState;
+	FMounteaBenchmarkTiming WidgetToggle;
+	FMounteaBenchmarkTiming EventDispatch;
+
+	double SpawnMsPerInteractable = 0.0;
+	/**
+	 * Heap allocations made by single Trace on Game Thread, -1 if allocation counting was not installed.
+	 */
+	double AllocationsPerTrace = -1.0;
+	double BytesPerInteractable = 0.0;
+	double ArchetypeBytesPerInteractable = 0.0;
+	double ProcessMemoryPerInteractable = 0.0;
+
+	static FString GetCSVHeader();
+	FString ToCSVRow(const FMounteaBenchmarkConfig& Config) const;
+};
+
+/**
+ * Headless interaction benchmark.
+ * Creates transient Game World, spawns grid of Interactables and Interactors moving along circular path and measures hot paths.
+ * Designed to run with `-nullrhi`.
+ */
+class FMounteaInteractionBenchmark
+{
+public:
+
+	explicit FMounteaInteractionBenchmark(const FMounteaBenchmarkConfig& InConfig);
+	~FMounteaInteractionBenchmark();
+
+	bool Run(FMounteaBenchmarkResult& OutResult);
+
+	/**
+	 * Walks every Interactable through fixed cycle of legal State transitions each frame.
+	 * Returns false if any transition did not reach its target State.
+	 */
+	bool RunStateTransitions(FMounteaBenchmarkTiming& OutTiming, int32& OutTransitionsPerFrame);
+
+	/**
+	 * Only spawns Interactables and measures their spawn cost and memory.
+	 */
+	bool RunSpawn(FMounteaBenchmarkResult& OutResult);
+
+	/**
+	 * Captures Interaction Snapshot of every spawned Interactable, overwrites captured values and restores them back.
+	 * Returns false if not every Interactable was captured and restored to captured values, or Snapshot IDs collide.
+	 */
+	bool RunSnapshot(double& OutCaptureMs, double& OutRestoreMs, int32& OutSnapshotBytes);
+
+	/**
+	 * Spawns every Interactable in single frame with deferred setup and ticks World until initialization queue drains.
+	 * Returns false if queue did not drain within frame limit or any Interactable was left uninitialized.
+	 */
+	bool RunDeferredInitialization(FMounteaBenchmarkTiming& OutTiming, double& OutSpawnMs, int32& OutFramesToDrain);
+
+	static bool WriteCSV(const FMounteaBenchmarkConfig& Config, const FMounteaBenchmarkResult& Result);
+
+	/**
+	 * Wraps GMalloc in proxy counting Game Thread allocations, if `-MounteaBenchAllocations` is on command line.
+	 * Called once on module startup, proxy forwards every call and is never removed, so no block ever crosses allocators.
+	 */
+	static void InstallAllocationCounting();
+
+	static bool IsCountingAllocations();
+
+	/**
+	 * Returns heap allocations made on Game Thread since counting was installed.
+	 */
+	static uint64 GetAllocationsCount();
+
+protected:
+
+	/**
+	 * Validates Config and creates World, logs why scenario cannot run.
+	 */
+	bool BeginScenario();
+	
+	bool CreateWorld();
+	void DestroyWorld();
+
+	void SpawnInteractables(FMounteaBenchmarkResult& OutResult);
+	void SpawnInteractors();
+
+	void MoveInteractors(const int32 Frame);
+	void RunFrame(FMounteaBenchmarkResult& OutResult);
+
+	ETraceType GetTraceType() const;
+
+protected:
+
+	FMounteaBenchmarkConfig Config;
+
+	UWorld* World = nullptr;
+	FVector GridCenter = FVector::ZeroVector;
+	float PathRadius = 0.f;
+
+	TArray<TWeakObjectPtr<UActorInteractableComponentBase>> Interactables;
+	TArray<TWeakObjectPtr<UActorInteractorComponentBase>> Interactors;
+
+	uint64 TracesCount = 0;
+	uint64 TraceAllocations = 0;
+};
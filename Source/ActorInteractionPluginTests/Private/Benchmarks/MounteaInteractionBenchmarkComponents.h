@@ -0,0 +1,75 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Interactor/ActorInteractorComponentOverlap.h"
+#include "Components/Interactor/ActorInteractorComponentTrace.h"
+#include "UObject/CoreNet.h"
+#include "MounteaInteractionBenchmarkComponents.generated.h"
+
+/**
+ * Trace Interactor exposing protected processing for benchmarking.
+ */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UMounteaBenchmarkInteractorTrace : public UActorInteractorComponentTrace
+{
+	GENERATED_BODY()
+
+public:
+
+	void RunTrace(const ETraceType NewTraceType)
+	{
+		TraceType = NewTraceType;
+		ProcessTrace();
+	};
+};
+
+/**
+ * Overlap Interactor exposing protected processing for benchmarking.
+ */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class UMounteaBenchmarkInteractorOverlap : public UActorInteractorComponentOverlap
+{
+	GENERATED_BODY()
+
+public:
+
+	void RunStartOverlap(UPrimitiveComponent* PrimitiveComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp)
+	{
+		HandleStartOverlap(PrimitiveComponent, OtherActor, OtherComp, FHitResult());
+	};
+};
+
+/**
+ * Package Map writing every object reference as packed NetGUID, matching references already acknowledged by Client.
+ * First send of dynamic object exports its path as well, so real cost is never lower.
+ */
+UCLASS(Transient)
+class UMounteaBenchmarkPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * NetGUID of first written object. Dynamic NetGUIDs are even and grow with every replicated object.
+	 */
+	uint32 FirstNetGUID = 2;
+
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override
+	{
+		uint32 netGUID = 0;
+		if (Obj)
+		{
+			netGUID = NetGUIDs.FindOrAdd(Obj, FirstNetGUID + NetGUIDs.Num() * 2);
+		}
+
+		Ar.SerializeIntPacked(netGUID);
+		return true;
+	};
+
+protected:
+
+	TMap<UObject*, uint32> NetGUIDs;
+};
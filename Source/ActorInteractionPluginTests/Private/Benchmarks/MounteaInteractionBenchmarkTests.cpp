@@ -0,0 +1,120 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentAutomatic.h"
+#include "Components/Interactable/ActorInteractableComponentHold.h"
+#include "Components/Interactable/ActorInteractableComponentHover.h"
+#include "Components/Interactable/ActorInteractableComponentMash.h"
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MounteaInteractionBenchmark
+{
+	static const TArray<TPair<FString, TSubclassOf<UActorInteractableComponentBase>>>& GetInteractableClasses()
+	{
+		static const TArray<TPair<FString, TSubclassOf<UActorInteractableComponentBase>>> interactableClasses =
+		{
+			{ TEXT("Press"), UActorInteractableComponentPress::StaticClass() },
+			{ TEXT("Hold"), UActorInteractableComponentHold::StaticClass() },
+			{ TEXT("Auto"), UActorInteractableComponentAutomatic::StaticClass() },
+			{ TEXT("Mash"), UActorInteractableComponentMash::StaticClass() },
+			{ TEXT("Hover"), UActorInteractableComponentHover::StaticClass() }
+		};
+		return interactableClasses;
+	}
+
+	static const TArray<TPair<FString, EMounteaBenchmarkInteractor>>& GetInteractorTypes()
+	{
+		static const TArray<TPair<FString, EMounteaBenchmarkInteractor>> interactorTypes =
+		{
+			{ TEXT("TracePrecise"), EMounteaBenchmarkInteractor::TracePrecise },
+			{ TEXT("TraceLoose"), EMounteaBenchmarkInteractor::TraceLoose },
+			{ TEXT("TraceCone"), EMounteaBenchmarkInteractor::TraceCone },
+			{ TEXT("Overlap"), EMounteaBenchmarkInteractor::Overlap }
+		};
+		return interactorTypes;
+	}
+}
+
+/**
+ * Runs one benchmark scenario per Interactable class and Interactor type combination.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark; Quit"
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FMounteaInteractionBenchmarkTest, "Mountea.Interaction.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FMounteaInteractionBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const auto& interactableClass : MounteaInteractionBenchmark::GetInteractableClasses())
+	{
+		for (const auto& interactorType : MounteaInteractionBenchmark::GetInteractorTypes())
+		{
+			const FString scenarioName = FString::Printf(TEXT("%s.%s"), *interactableClass.Key, *interactorType.Key);
+			
+			OutBeautifiedNames.Add(scenarioName);
+			OutTestCommands.Add(scenarioName);
+		}
+	}
+}
+
+bool FMounteaInteractionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FString interactableName;
+	FString interactorName;
+	if (!Parameters.Split(TEXT("."), &interactableName, &interactorName))
+	{
+		AddError(FString::Printf(TEXT("Invalid benchmark scenario '%s'"), *Parameters));
+		return false;
+	}
+
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+	config.ScenarioName = Parameters;
+
+	for (const auto& Itr : MounteaInteractionBenchmark::GetInteractableClasses())
+	{
+		if (Itr.Key == interactableName)
+		{
+			config.InteractableClass = Itr.Value;
+		}
+	}
+
+	for (const auto& Itr : MounteaInteractionBenchmark::GetInteractorTypes())
+	{
+		if (Itr.Key == interactorName)
+		{
+			config.InteractorType = Itr.Value;
+		}
+	}
+
+	FMounteaBenchmarkResult result;
+	{
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.Run(result))
+		{
+			AddError(FString::Printf(TEXT("Benchmark scenario '%s' failed to run"), *Parameters));
+			return false;
+		}
+	}
+
+	AddInfo(FMounteaBenchmarkResult::GetCSVHeader());
+	AddInfo(result.ToCSVRow(config));
+
+	if (!FMounteaInteractionBenchmark::IsCountingAllocations())
+	{
+		AddInfo(TEXT("Allocations are not counted, run with -MounteaBenchAllocations to count them"));
+	}
+
+	if (!FMounteaInteractionBenchmark::WriteCSV(config, result))
+	{
+		AddWarning(FString::Printf(TEXT("Failed to write benchmark results to '%s'"), *config.OutputPath));
+	}
+
+	return true;
+}
+
+#endif
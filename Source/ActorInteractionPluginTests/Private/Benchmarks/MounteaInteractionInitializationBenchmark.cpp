@@ -0,0 +1,64 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures streaming of whole cell of Interactables in single frame.
+ * Reports spawn frame cost with full setup in BeginPlay compared to deferred setup, and frame cost while budgeted queue drains.
+ * Deferred scenario runs with `-MounteaBenchInitBudget` (2 ms by default), regardless of the opt-in project setting.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.Initialization; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionInitializationBenchmarkTest, "Mountea.Interaction.Benchmark.Initialization", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionInitializationBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+	config.InteractableClass = UActorInteractableComponentPress::StaticClass();
+
+	// Full setup in BeginPlay
+	FMounteaBenchmarkResult immediateResult;
+	{
+		config.ScenarioName = TEXT("Initialization.Immediate");
+
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunSpawn(immediateResult))
+		{
+			AddError(TEXT("Failed to spawn Interactables"));
+			return false;
+		}
+	}
+
+	// Setup spread over frames
+	{
+		config.ScenarioName = TEXT("Initialization.Deferred");
+		config.bDeferInitialization = true;
+
+		FMounteaBenchmarkTiming drainTiming;
+		double deferredSpawnMs = 0.0;
+		int32 framesToDrain = 0;
+
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunDeferredInitialization(drainTiming, deferredSpawnMs, framesToDrain))
+		{
+			AddError(TEXT("Initialization queue did not initialize every Interactable"));
+			return false;
+		}
+
+		AddInfo(FString::Printf(TEXT("Spawn frame: %.3f ms immediate, %.3f ms deferred (%d Interactables)"),
+			immediateResult.SpawnMsPerInteractable * config.InteractablesCount, deferredSpawnMs, config.InteractablesCount));
+		AddInfo(FString::Printf(TEXT("Queue drained in %d frames, %.3f ms avg, %.3f ms max per frame"),
+			framesToDrain, drainTiming.GetAverageMs(), drainTiming.MaxMs));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,142 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+#include "MounteaInteractionBenchmarkComponents.h"
+
+#include "Components/SphereComponent.h"
+#include "Helpers/MounteaInteractionNetTypes.h"
+
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MounteaRpcPayloadBenchmark
+{
+	template<typename SerializeFunctionType>
+	static int64 MeasureBits(UPackageMap* PackageMap, SerializeFunctionType&& SerializeFunction)
+	{
+		FNetBitWriter bitWriter(PackageMap, 1024 * 8);
+		SerializeFunction(bitWriter);
+		return bitWriter.GetNumBits();
+	}
+
+	static void WriteObject(FNetBitWriter& Writer, UObject* Object)
+	{
+		Writer << Object;
+	}
+}
+
+/**
+ * Measures RPC parameter payloads before and after sending Interaction Handles.
+ * Overlap RPCs are no longer sent, Server processes overlaps from its own physics.
+ * Object references are counted as acknowledged NetGUIDs, the cheapest case for them.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.RpcPayload; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionRpcPayloadBenchmarkTest, "Mountea.Interaction.Benchmark.RpcPayload", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionRpcPayloadBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace MounteaRpcPayloadBenchmark;
+
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+
+	// Every Interactable replicates its Actor and Component, the last spawned Interactable is sent
+	const TStrongObjectPtr<UMounteaBenchmarkPackageMap> packageMap(NewObject<UMounteaBenchmarkPackageMap>(GetTransientPackage()));
+	packageMap->FirstNetGUID = config.InteractablesCount * 2;
+
+	const TStrongObjectPtr<USphereComponent> interactableObject(NewObject<USphereComponent>(GetTransientPackage()));
+	const TStrongObjectPtr<USphereComponent> overlappedComponent(NewObject<USphereComponent>(GetTransientPackage()));
+	const TStrongObjectPtr<USphereComponent> otherComponent(NewObject<USphereComponent>(GetTransientPackage()));
+
+	const FMounteaInteractionHandle interactableHandle(FMath::Min(static_cast<uint32>(config.InteractablesCount), FMounteaInteractionHandle::MaxIndex), 1);
+
+	FHitResult sweepResult(nullptr, otherComponent.Get(), FVector(1250.f, -830.f, 95.f), FVector(0.f, 0.707f, 0.707f));
+	sweepResult.Location = sweepResult.ImpactPoint + FVector(0.f, 0.f, 12.f);
+	sweepResult.Time = 0.35f;
+	sweepResult.Distance = 42.f;
+	sweepResult.bBlockingHit = false;
+	sweepResult.bStartPenetrating = true;
+
+	float viewTime = 1234.5f;
+	bool bSuccess = true;
+
+	struct FPayloadRow
+	{
+		const TCHAR* Name;
+		int64 BeforeBits;
+		int64 AfterBits;
+	};
+
+	struct FRemovedPayloadRow
+	{
+		const TCHAR* Name;
+		int64 Bits;
+	};
+
+	TArray<FPayloadRow> payloadRows;
+	TArray<FRemovedPayloadRow> removedPayloadRows;
+
+	// Set Active Interactable, Add and Remove Interaction Dependency send single Interface
+	payloadRows.Add(
+	{
+		TEXT("SetActiveInteractable"),
+		MeasureBits(packageMap.Get(), [&](FNetBitWriter& Writer) { WriteObject(Writer, interactableObject.Get()); }),
+		MeasureBits(packageMap.Get(), [&](FNetBitWriter& Writer) { FMounteaInteractionHandle handle = interactableHandle; handle.NetSerialize(Writer, packageMap.Get(), bSuccess); })
+	});
+
+	// Overlap RPCs have no replacement payload, their whole cost is saved
+	removedPayloadRows.Add(
+	{
+		TEXT("ProcessOverlap"),
+		MeasureBits(packageMap.Get(), [&](FNetBitWriter& Writer)
+		{
+			WriteObject(Writer, overlappedComponent.Get());
+			WriteObject(Writer, nullptr);
+			WriteObject(Writer, otherComponent.Get());
+			sweepResult.NetSerialize(Writer, packageMap.Get(), bSuccess);
+			Writer.WriteBit(1);
+			Writer << viewTime;
+		})
+	});
+
+	removedPayloadRows.Add(
+	{
+		TEXT("StartInteractorOverlap"),
+		MeasureBits(packageMap.Get(), [&](FNetBitWriter& Writer)
+		{
+			WriteObject(Writer, overlappedComponent.Get());
+			WriteObject(Writer, nullptr);
+			WriteObject(Writer, otherComponent.Get());
+			int32 otherBodyIndex = 0;
+			Writer << otherBodyIndex;
+			Writer.WriteBit(1);
+			sweepResult.NetSerialize(Writer, packageMap.Get(), bSuccess);
+		})
+	});
+
+	for (const FPayloadRow& payloadRow : payloadRows)
+	{
+		AddInfo(FString::Printf(TEXT("%s: %lld bits (%.1f B) -> %lld bits (%.1f B) per RPC"),
+			payloadRow.Name, payloadRow.BeforeBits, payloadRow.BeforeBits / 8.0, payloadRow.AfterBits, payloadRow.AfterBits / 8.0));
+
+		if (payloadRow.AfterBits > payloadRow.BeforeBits)
+		{
+			AddError(FString::Printf(TEXT("%s payload grew"), payloadRow.Name));
+		}
+	}
+
+	for (const FRemovedPayloadRow& removedPayloadRow : removedPayloadRows)
+	{
+		AddInfo(FString::Printf(TEXT("%s: %lld bits (%.1f B) per RPC, no longer sent"),
+			removedPayloadRow.Name, removedPayloadRow.Bits, removedPayloadRow.Bits / 8.0));
+	}
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,75 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Compares lean dedicated server setup of Interactables with full setup.
+ * Lean scenario runs with `Mountea.Interaction.Cosmetics` off, so Editor and Clients skip cosmetics the same way dedicated servers do.
+ * Full scenario is skipped when running as dedicated server, cosmetics never run there.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -server -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.DedicatedServer; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionServerBenchmarkTest, "Mountea.Interaction.Benchmark.DedicatedServer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionServerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* cosmeticsVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("Mountea.Interaction.Cosmetics"));
+	if (!cosmeticsVariable)
+	{
+		AddError(TEXT("Mountea.Interaction.Cosmetics console variable is missing"));
+		return false;
+	}
+
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+	config.InteractableClass = UActorInteractableComponentPress::StaticClass();
+
+	const bool bCosmeticsBefore = cosmeticsVariable->GetBool();
+	const bool bDedicatedServer = IsRunningDedicatedServer();
+
+	AddInfo(FMounteaBenchmarkResult::GetCSVHeader());
+
+	bool bSuccess = true;
+	for (const bool bCosmetics : { true, false })
+	{
+		if (bCosmetics && bDedicatedServer)
+		{
+			AddInfo(TEXT("Full setup skipped, dedicated server never runs cosmetics"));
+			continue;
+		}
+
+		config.ScenarioName = bCosmetics ? TEXT("DedicatedServer.Full") : TEXT("DedicatedServer.Lean");
+		cosmeticsVariable->Set(bCosmetics, ECVF_SetByCode);
+
+		FMounteaBenchmarkResult result;
+		{
+			FMounteaInteractionBenchmark benchmark(config);
+			if (!benchmark.Run(result))
+			{
+				AddError(FString::Printf(TEXT("Benchmark scenario '%s' failed to run"), *config.ScenarioName));
+				bSuccess = false;
+				break;
+			}
+		}
+
+		AddInfo(result.ToCSVRow(config));
+
+		if (!FMounteaInteractionBenchmark::WriteCSV(config, result))
+		{
+			AddWarning(FString::Printf(TEXT("Failed to write benchmark results to '%s'"), *config.OutputPath));
+		}
+	}
+
+	cosmeticsVariable->Set(bCosmeticsBefore, ECVF_SetByCode);
+
+	return bSuccess;
+}
+
+#endif
@@ -0,0 +1,139 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Helpers/MounteaInteractionSnapshot.h"
+
+#include "HAL/PlatformTime.h"
+#include "Hash/CityHash.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures Interaction Snapshot size and speed compared to SaveGame reflection of Interactable components.
+ * Reports 100k synthetic records, SaveGame serialization of single component extrapolated to the same count and full World capture and restore.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.Snapshot; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionSnapshotBenchmarkTest, "Mountea.Interaction.Benchmark.Snapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionSnapshotBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+	config.ScenarioName = TEXT("Snapshot");
+	config.InteractableClass = UActorInteractableComponentPress::StaticClass();
+
+	constexpr int32 recordsCount = 100000;
+
+	// Synthetic records
+	double snapshotBytesPerRecord = 0.0;
+	double snapshotNsPerRecord = 0.0;
+	{
+		TArray<FMounteaInteractableSnapshotRecord> records;
+		records.SetNum(recordsCount);
+
+		for (int32 i = 0; i < recordsCount; i++)
+		{
+			FMounteaInteractableSnapshotRecord& record = records[i];
+			record.Id = CityHash64(reinterpret_cast<const char*>(&i), sizeof(i));
+			record.State = i % 3 == 0 ? EInteractableStateV2::EIS_Asleep : (i % 5 == 0 ? EInteractableStateV2::EIS_Cooldown : EInteractableStateV2::EIS_Awake);
+			record.RemainingLifecycleCount = i % 4 == 0 ? i % 10 : -1;
+			record.InteractionWeight = i % 7;
+			record.RemainingCooldown = record.State == EInteractableStateV2::EIS_Cooldown ? 2.5f : 0.f;
+		}
+
+		TArray<uint8> snapshot;
+
+		double startTime = FPlatformTime::Seconds();
+		FMounteaInteractionSnapshot::WriteRecords(records, snapshot);
+		const double writeMs = (FPlatformTime::Seconds() - startTime) * 1000.0;
+
+		TArray<FMounteaInteractableSnapshotRecord> readRecords;
+
+		startTime = FPlatformTime::Seconds();
+		const bool bRead = FMounteaInteractionSnapshot::ReadRecords(snapshot, readRecords);
+		const double readMs = (FPlatformTime::Seconds() - startTime) * 1000.0;
+
+		if (!bRead || readRecords.Num() != recordsCount)
+		{
+			AddError(TEXT("Snapshot records did not survive round trip"));
+			return false;
+		}
+
+		for (int32 i = 0; i < recordsCount; i++)
+		{
+			if (readRecords[i].Id != records[i].Id || readRecords[i].State != records[i].State || readRecords[i].RemainingLifecycleCount != records[i].RemainingLifecycleCount
+				|| readRecords[i].InteractionWeight != records[i].InteractionWeight || readRecords[i].RemainingCooldown != records[i].RemainingCooldown)
+			{
+				AddError(FString::Printf(TEXT("Snapshot record %d differs after round trip"), i));
+				return false;
+			}
+		}
+
+		snapshotBytesPerRecord = static_cast<double>(snapshot.Num()) / recordsCount;
+		snapshotNsPerRecord = (writeMs + readMs) * 1.0e6 / recordsCount;
+
+		AddInfo(FString::Printf(TEXT("Snapshot: %d records, %d B (%.2f B per record), write %.3f ms, read %.3f ms"), recordsCount, snapshot.Num(), snapshotBytesPerRecord, writeMs, readMs));
+	}
+
+	// SaveGame reflection of single component, extrapolated
+	{
+		const TStrongObjectPtr<UActorInteractableComponentPress> interactable(NewObject<UActorInteractableComponentPress>(GetTransientPackage()));
+
+		constexpr int32 serializationsCount = 10000;
+
+		TArray<uint8> saveData;
+		int64 totalBytes = 0;
+
+		const double startTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < serializationsCount; i++)
+		{
+			saveData.Reset();
+
+			FMemoryWriter memoryWriter(saveData, true);
+			FObjectAndNameAsStringProxyArchive saveArchive(memoryWriter, false);
+			saveArchive.ArIsSaveGame = true;
+
+			interactable->Serialize(saveArchive);
+			totalBytes += saveData.Num();
+		}
+		const double reflectionNsPerRecord = (FPlatformTime::Seconds() - startTime) * 1.0e9 / serializationsCount;
+		const double reflectionBytesPerRecord = static_cast<double>(totalBytes) / serializationsCount;
+
+		AddInfo(FString::Printf(TEXT("SaveGame reflection: %.2f B per record, %.1f ns write per record, %.3f ms for %d records"),
+			reflectionBytesPerRecord, reflectionNsPerRecord, reflectionNsPerRecord * recordsCount / 1.0e6, recordsCount));
+
+		if (snapshotBytesPerRecord > reflectionBytesPerRecord)
+		{
+			AddError(TEXT("Snapshot records are larger than SaveGame reflection"));
+		}
+	}
+
+	// Full World capture and restore
+	{
+		double captureMs = 0.0;
+		double restoreMs = 0.0;
+		int32 snapshotBytes = 0;
+
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunSnapshot(captureMs, restoreMs, snapshotBytes))
+		{
+			AddError(TEXT("Not every Interactable was captured and restored to captured values"));
+			return false;
+		}
+
+		AddInfo(FString::Printf(TEXT("World: %d Interactables, %d B, capture %.3f ms, restore %.3f ms (%.1f ns record encoding)"),
+			config.InteractablesCount, snapshotBytes, captureMs, restoreMs, snapshotNsPerRecord));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,66 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#include "MounteaInteractionBenchmark.h"
+
+#include "Components/Interactable/ActorInteractableComponentPress.h"
+#include "Helpers/MounteaInteractionStateMachine.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures cost of State transitions.
+ * Reports raw table lookup cost and full SetState cost including side effects.
+ * Usage:
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Mountea.Interaction.Benchmark.StateMachine; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMounteaInteractionStateMachineBenchmarkTest, "Mountea.Interaction.Benchmark.StateMachine", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FMounteaInteractionStateMachineBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FMounteaBenchmarkConfig config;
+	config.ParseCommandLine();
+	config.ScenarioName = TEXT("StateMachine");
+	config.InteractableClass = UActorInteractableComponentPress::StaticClass();
+
+	// Table lookup
+	{
+		constexpr int32 numStates = FInteractableStateTable::NumStates;
+		constexpr int32 lookupsCount = 1000000;
+		
+		uint32 allowedCount = 0;
+		const double startTime = FPlatformTime::Seconds();
+		
+		for (int32 i = 0; i < lookupsCount; i++)
+		{
+			const EInteractableStateV2 fromState = static_cast<EInteractableStateV2>(i % numStates);
+			const EInteractableStateV2 toState = static_cast<EInteractableStateV2>((i / numStates) % numStates);
+			allowedCount += MounteaInteractionStateMachine::InteractableStateTable.IsAllowed(fromState, toState) ? 1 : 0;
+		}
+
+		const double lookupNs = (FPlatformTime::Seconds() - startTime) * 1.0e9 / lookupsCount;
+		AddInfo(FString::Printf(TEXT("Table lookup: %.2f ns (%u allowed)"), lookupNs, allowedCount));
+	}
+
+	// Full transitions
+	{
+		FMounteaBenchmarkTiming timing;
+		int32 transitionsPerFrame = 0;
+		
+		FMounteaInteractionBenchmark benchmark(config);
+		if (!benchmark.RunStateTransitions(timing, transitionsPerFrame))
+		{
+			AddError(TEXT("State transition cycle did not reach expected States"));
+			return false;
+		}
+
+		const double transitionNs = transitionsPerFrame > 0 ? timing.GetAverageMs() * 1.0e6 / transitionsPerFrame : 0.0;
+		AddInfo(FString::Printf(TEXT("SetState: %.4f ms avg, %.4f ms max per frame, %.1f ns per transition (%d transitions per frame)"), timing.GetAverageMs(), timing.MaxMs, transitionNs, transitionsPerFrame));
+	}
+
+	return true;
+}
+
+#endif
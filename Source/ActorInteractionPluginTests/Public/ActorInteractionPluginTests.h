@@ -0,0 +1,18 @@
+// All rights reserved Dominik Morse (Pavlicek) 2024
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogActorInteractionTests, Log, All);
+
+class FActorInteractionPluginTests : public IModuleInterface
+{
+	public:
+
+	/* Called when the module is loaded */
+	virtual void StartupModule() override;
+
+	/* Called when the module is unloaded */
+	virtual void ShutdownModule() override;
+};